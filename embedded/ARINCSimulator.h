@@ -1,6 +1,6 @@
 /**
  * @file ARINCSimulator.h
- * @brief Simulateur de protocole ARINC 429 sur Serial
+ * @brief Simulateur de protocole ARINC 429 sur le port série
  * @author Hackathon FlyImpulse - Safran PW100
  * @date 2026-02-07
  * 
@@ -11,19 +11,31 @@
 #define ARINC_SIMULATOR_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include "PowerDistribution.h"
+#include "TraceBuffer.h"
+#include "LogCatalog.h"
+#include "Calibration.h"
+#include "UsageStats.h"
+#include "ModeLimits.h"
+#include "PowerState.h"
+#include "TopicBus.h"
+#include "SerialLink.h"
+#include "LinkRate.h"
 
 /**
  * @brief Classe de simulation ARINC 429
  * 
- * Formate les données de vol en messages ARINC-like sur Serial
+ * Formate les données de vol en messages ARINC-like sur un SerialLink
  */
 class ARINCSimulator {
 public:
     /**
      * @brief Constructeur
+     * 
+     * @param port Port série instrumenté (doit survivre au simulateur)
      */
-    ARINCSimulator();
+    explicit ARINCSimulator(SerialLink& port);
 
     /**
      * @brief Initialise le simulateur ARINC
@@ -37,9 +49,20 @@ public:
      */
     void sendSystemBanner();
 
+    /**
+     * @brief Envoie une ligne du banner (affichage différé, basse priorité)
+     * 
+     * @param line Rang de la ligne (0 = première)
+     * @return false si la ligne n'existe pas (banner terminé)
+     */
+    bool sendSystemBannerLine(uint8_t line);
+
     /**
      * @brief Envoie une trame de puissance totale
      * 
+     * Trames périodiques (puissances, batterie, état): classe TELEMETRY,
+     * une trame non encore émise est remplacée par la suivante.
+     * 
      * @param power Puissance totale (Cv)
      */
     void sendTotalPower(uint16_t power);
@@ -59,52 +82,161 @@ public:
     void sendThermalPower(uint16_t power);
 
     /**
-     * @brief Envoie une trame de changement de mode
+     * @brief Envoie une trame d'état batterie
+     * 
+     * @param soc État de charge (‰)
+     * @param boostTime Autonomie boost à puissance maximale (s)
+     */
+    void sendBattery(uint16_t soc, uint16_t boostTime);
+
+    /**
+     * @brief Envoie une trame de changement de mode (classe SAFETY)
      * 
      * @param mode Nouveau mode
      */
     void sendFlightMode(PowerDistribution::FlightMode mode);
 
     /**
-     * @brief Envoie le statut système complet
+     * @brief Envoie le mot d'état système (label 274)
+     * 
+     * @param status Mot compacté (Metrics::packStatus)
+     */
+    void sendSystemStatus(uint32_t status);
+
+    /**
+     * @brief Envoie le statut système complet (Cv et W)
      * 
-     * @param mode Mode de vol actif
-     * @param totalPower Puissance totale (Cv)
-     * @param electricPower Puissance électrique (Cv)
-     * @param thermalPower Puissance thermique (Cv)
+     * @param state Instantané de l'état opérateur (PowerState)
      */
-    void sendFullStatus(
-        PowerDistribution::FlightMode mode,
-        uint16_t totalPower,
-        uint16_t electricPower,
-        uint16_t thermalPower
-    );
+    void sendFullStatus(const PowerState::Snapshot& state);
 
     /**
      * @brief Envoie un tableau de bord formaté
      * 
-     * @param mode Mode de vol actif
-     * @param totalPower Puissance totale (Cv)
-     * @param electricPower Puissance électrique (Cv)
-     * @param thermalPower Puissance thermique (Cv)
+     * @param state Instantané de l'état opérateur (barres précalculées)
+     */
+    void sendDashboard(const PowerState::Snapshot& state);
+
+    /**
+     * @brief Émet un message de diagnostic du catalogue (LogCatalog.h)
+     * 
+     * LOG_DEFERRED = 0: texte formaté sur la cible.
+     * LOG_DEFERRED = 1: trame binaire {id, SEQ, arguments}, décodée sur PC
+     * par tools/log_decoder.py (les chaînes ne sont pas embarquées).
+     * Classe SAFETY dans les deux cas: jamais perdu sous saturation.
+     * 
+     * @param id Identifiant du message
+     * @param args Arguments entiers (convertis en uint32_t)
+     */
+    template<typename... Args>
+    void sendLog(LogId id, Args... args) {
+        const uint32_t values[] = { 0U, static_cast<uint32_t>(args)... };
+        emitLog(id, &values[1], static_cast<uint8_t>(sizeof...(Args)));
+    }
+
+    /**
+     * @brief Vide le journal boîte noire, du plus ancien au plus récent
+     *
+     * Une ligne par événement: "<horodatage µs> <type> <A> <B>" en hexadécimal.
+     * Recharge le watchdog pendant la vidange (journal plein ≈ 2 s à 115200) ;
+     * attend la place dans la file UI plutôt que de perdre des lignes.
+     *
+     * @param trace Journal à vider
      */
-    void sendDashboard(
-        PowerDistribution::FlightMode mode,
-        uint16_t totalPower,
-        uint16_t electricPower,
-        uint16_t thermalPower
-    );
+    void sendTrace(const TraceBuffer& trace);
 
     /**
-     * @brief Envoie un message d'erreur
+     * @brief Envoie le résumé d'une courbe de calibration
      * 
-     * @param errorMsg Message d'erreur
+     * @param curve Courbe à décrire
+     * @param demand Demande actuelle de la source (Cv)
+     */
+    void sendCalibration(const CalibrationCurve& curve, uint16_t demand);
+
+    /**
+     * @brief Envoie les statistiques d'utilisation (3 lignes par mode)
+     *
+     * "<mode> | temps s | écrêtages | déficit s" puis, par moteur,
+     * "min/moy/max Cv | s par bande de 2^USAGE_BAND_SHIFT Cv".
+     *
+     * @param stats Cumuls
+     * @param tickMs Période des cumuls (ms)
+     */
+    void sendUsage(const UsageStats& stats, uint16_t tickMs);
+
+    /**
+     * @brief Envoie une table de limites (une ligne par mode + génération/CRC)
+     *
+     * "<mode> | min..max Cv | init | élec | therm | pentes élec/therm",
+     * champs dans l'ordre de la commande 'k'.
+     *
+     * @param table Table à décrire
+     * @param generation Échanges publiés
      */
-    void sendError(const char* errorMsg);
+    void sendLimits(const ModeLimits::Table& table, uint16_t generation);
+
+    /**
+     * @brief Envoie toutes les métriques, une ligne par métrique
+     */
+    void sendMetrics();
+
+    /**
+     * @brief Envoie les compteurs du bus interne, une ligne par sujet
+     */
+    void sendTopics();
+
+    /**
+     * @brief Envoie les compteurs d'émission, une ligne par classe
+     *
+     * "<classe> | messages | octets | remplacés | perdus | attentes | file max"
+     */
+    void sendOutputClasses();
+
+    /**
+     * @brief Envoie l'état de la négociation de vitesse
+     *
+     * "<active> bps | confirmée | état | confirmations | replis"
+     *
+     * @param rate Négociation
+     */
+    void sendLinkRate(const LinkRate& rate);
 
 private:
+    /**
+     * @brief Clés de télémesure (un emplacement SerialLink par mot ARINC)
+     */
+    enum TelemetryKey : uint8_t {
+        TELEMETRY_TOTAL = 0,
+        TELEMETRY_ELECTRIC,
+        TELEMETRY_THERMAL,
+        TELEMETRY_BATTERY,
+        TELEMETRY_STATUS,
+        TELEMETRY_KEY_COUNT
+    };
+
+    static_assert(TELEMETRY_KEY_COUNT <= OUTPUT_TELEMETRY_SLOTS, "OUTPUT_TELEMETRY_SLOTS trop petit");
+
+    SerialLink& port_;         ///< Port série
     uint32_t messageCounter_;  ///< Compteur de messages (séquence)
 
+    /**
+     * @brief Émission effective d'un message de diagnostic
+     * 
+     * @param id Identifiant du message
+     * @param args Arguments
+     * @param count Nombre d'arguments (max LOG_MAX_ARGS)
+     */
+    void emitLog(LogId id, const uint32_t* args, uint8_t count);
+
+    /**
+     * @brief Encode un entier en varint (7 bits par octet, LSB d'abord)
+     * 
+     * @param value Valeur à encoder
+     * @param buffer Buffer de sortie (min 5 octets)
+     * @return Nombre d'octets écrits
+     */
+    static uint8_t encodeVarint(uint32_t value, uint8_t* buffer);
+
     /**
      * @brief Formatte un label ARINC en hexadécimal
      * 
@@ -113,6 +245,15 @@ private:
      */
     void formatLabel(uint16_t label, char* buffer) const;
 
+    /**
+     * @brief Écrit une valeur en hexadécimal sur un nombre fixe de chiffres
+     *
+     * @param value Valeur à formater
+     * @param digits Nombre de chiffres
+     * @param buffer Buffer de sortie (min digits chars, non terminé)
+     */
+    void formatHex(uint32_t value, uint8_t digits, char* buffer) const;
+
     /**
      * @brief Calcule un checksum simple (somme modulo 256)
      * 
@@ -122,6 +263,22 @@ private:
      */
     uint8_t calculateChecksum(const uint8_t* data, size_t length) const;
 
+    /**
+     * @brief Ligne de puissance du statut complet (Cv, W, cadre aligné)
+     * 
+     * @param label Libellé (24 colonnes)
+     * @param power Puissance (Cv)
+     * @param watts Puissance (W)
+     */
+    void printPowerLine(const __FlashStringHelper* label, uint16_t power, uint32_t watts);
+
+    /**
+     * @brief Barre de BAR_WIDTH caractères, pleine sur length
+     * 
+     * @param length Longueur pleine (caractères)
+     */
+    void printBar(uint8_t length);
+
     /**
      * @brief Retourne le nom du mode de vol
      * 
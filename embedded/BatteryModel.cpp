@@ -0,0 +1,147 @@
+/**
+ * @file BatteryModel.cpp
+ * @brief Implémentation du modèle de batterie
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "BatteryModel.h"
+#include "config.h"
+#include "PowerUnits.h"
+
+namespace {
+    /** @brief Capacité en mA·ms */
+    constexpr uint64_t CAPACITY_CHARGE = static_cast<uint64_t>(BATTERY_CAPACITY_MAH) * 3600000ULL;
+
+    /** @brief Réserve non utilisée pour le boost (mA·ms) */
+    constexpr uint64_t RESERVE_CHARGE = (CAPACITY_CHARGE / 1000U) * BATTERY_RESERVE_PERMILLE;
+
+    /** @brief Températures en µ°C */
+    constexpr int32_t AMBIENT = BATTERY_AMBIENT_C * 1000000L;
+    constexpr int32_t DERATE_START = BATTERY_DERATE_START_C * 1000000L;
+    constexpr int32_t DERATE_END = BATTERY_DERATE_END_C * 1000000L;
+
+    static_assert(BATTERY_VOLTAGE_FULL_MV > BATTERY_VOLTAGE_EMPTY_MV, "Tensions batterie incohérentes");
+    static_assert(BATTERY_DERATE_END_C > BATTERY_DERATE_START_C, "Plage de déclassement vide");
+    static_assert(BATTERY_RESISTANCE_MOHM > 0U, "Résistance interne nulle");
+}
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+BatteryModel::BatteryModel(uint16_t tickMs)
+    : tickMs_(tickMs)
+{
+    reset();
+}
+
+void BatteryModel::reset() {
+    charge_ = CAPACITY_CHARGE;
+    temperature_ = AMBIENT;
+    heatRemainder_ = 0U;
+    current_ = 0U;
+    voltage_ = openCircuitVoltage();
+    updateLimits();
+}
+
+// ============================================================================
+// INTÉGRATION
+// ============================================================================
+
+void BatteryModel::tick(uint16_t electricPower) {
+    const uint32_t ocv = openCircuitVoltage();
+
+    // Courant sous la tension aux bornes du tick précédent (mA = µW / mV)
+    const uint64_t power = static_cast<uint64_t>(PowerUnits::cvToWatts(electricPower)) * 1000000ULL;
+    current_ = (voltage_ > 0U) ? static_cast<uint32_t>(power / voltage_) : 0U;
+
+    const uint32_t drop = static_cast<uint32_t>((static_cast<uint64_t>(current_) * BATTERY_RESISTANCE_MOHM) / 1000U);
+    voltage_ = (ocv > drop) ? (ocv - drop) : 0U;
+
+    // Coulométrie
+    const uint64_t used = static_cast<uint64_t>(current_) * tickMs_;
+    charge_ = (charge_ > used) ? (charge_ - used) : 0U;
+
+    // Échauffement R·I² (µJ) et refroidissement vers l'ambiante
+    const uint64_t heat = (static_cast<uint64_t>(current_) * current_ * BATTERY_RESISTANCE_MOHM * tickMs_) / 1000000ULL;
+    const uint64_t pending = heatRemainder_ + heat;
+    temperature_ += static_cast<int32_t>(pending / BATTERY_HEAT_CAPACITY_J_PER_K);
+    heatRemainder_ = static_cast<uint32_t>(pending % BATTERY_HEAT_CAPACITY_J_PER_K);
+
+    const int64_t excess = static_cast<int64_t>(temperature_) - AMBIENT;
+    temperature_ -= static_cast<int32_t>((excess * tickMs_) / (static_cast<int64_t>(BATTERY_COOLING_TAU_S) * 1000));
+
+    updateLimits();
+}
+
+uint32_t BatteryModel::openCircuitVoltage() const {
+    const uint64_t span = BATTERY_VOLTAGE_FULL_MV - BATTERY_VOLTAGE_EMPTY_MV;
+    return BATTERY_VOLTAGE_EMPTY_MV + static_cast<uint32_t>((span * charge_) / CAPACITY_CHARGE);
+}
+
+void BatteryModel::updateLimits() {
+    soc_ = static_cast<uint16_t>((charge_ * 1000U) / CAPACITY_CHARGE);
+
+    // Déclassement linéaire en température (‰)
+    uint32_t derate = 1000U;
+    if (temperature_ >= DERATE_END) {
+        derate = 0U;
+    } else if (temperature_ > DERATE_START) {
+        derate = static_cast<uint32_t>((static_cast<int64_t>(DERATE_END - temperature_) * 1000)
+                                       / (DERATE_END - DERATE_START));
+    }
+
+    uint32_t maxCurrent = (BATTERY_MAX_C_RATE * BATTERY_CAPACITY_MAH * derate) / 1000U;
+
+    // Tension de coupure: I ≤ (OCV - Vmin) / R
+    const uint32_t ocv = openCircuitVoltage();
+    const uint32_t headroom = (ocv > BATTERY_CUTOFF_MV)
+                            ? static_cast<uint32_t>((static_cast<uint64_t>(ocv - BATTERY_CUTOFF_MV) * 1000U) / BATTERY_RESISTANCE_MOHM)
+                            : 0U;
+    maxCurrent = (maxCurrent < headroom) ? maxCurrent : headroom;
+
+    if (charge_ <= RESERVE_CHARGE) {
+        maxCurrent = 0U;
+    }
+    maxCurrent_ = maxCurrent;
+
+    // Puissance maximale = I × (OCV - R·I) (W = mA × mV / 10^6)
+    const uint32_t drop = static_cast<uint32_t>((static_cast<uint64_t>(maxCurrent) * BATTERY_RESISTANCE_MOHM) / 1000U);
+    const uint32_t watts = static_cast<uint32_t>((static_cast<uint64_t>(maxCurrent) * (ocv - drop)) / 1000000ULL);
+    const uint16_t limit = PowerUnits::wattsToCv(watts);
+    powerLimit_ = (limit < BATTERY_MAX_POWER) ? limit : static_cast<uint16_t>(BATTERY_MAX_POWER);
+}
+
+// ============================================================================
+// ACCESSEURS
+// ============================================================================
+
+uint16_t BatteryModel::getSoc() const {
+    return soc_;
+}
+
+uint16_t BatteryModel::getPowerLimit() const {
+    return powerLimit_;
+}
+
+uint16_t BatteryModel::getBoostTime() const {
+    if ((maxCurrent_ == 0U) || (charge_ <= RESERVE_CHARGE)) {
+        return 0U;
+    }
+
+    const uint64_t seconds = (charge_ - RESERVE_CHARGE) / (static_cast<uint64_t>(maxCurrent_) * 1000U);
+    return (seconds < 0xFFFFU) ? static_cast<uint16_t>(seconds) : 0xFFFFU;
+}
+
+uint32_t BatteryModel::getVoltage() const {
+    return voltage_;
+}
+
+uint32_t BatteryModel::getCurrent() const {
+    return current_;
+}
+
+int16_t BatteryModel::getTemperature() const {
+    return static_cast<int16_t>(temperature_ / 100000L);
+}
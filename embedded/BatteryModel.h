@@ -0,0 +1,112 @@
+/**
+ * @file BatteryModel.h
+ * @brief Modèle de batterie : état de charge, tension, échauffement, limites
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#ifndef BATTERY_MODEL_H
+#define BATTERY_MODEL_H
+
+#include <stdint.h>
+
+/**
+ * @brief Intégration incrémentale de la batterie à chaque tick de contrôle
+ *
+ * Tout est entier (charge en mA·ms, tensions en mV, température en µ°C) :
+ * un même historique de commandes donne le même état, bit à bit, sur PC
+ * et sur cible.
+ *
+ * Modèle par tick:
+ * - tension à vide linéaire en charge, chute ohmique R × I ;
+ * - courant = puissance électrique / tension aux bornes du tick précédent ;
+ * - pertes R × I² chauffant le pack, refroidissement du 1er ordre ;
+ * - courant maximal = C-rate, déclassé en température, borné par la
+ *   tension de coupure ; nul sous la réserve de charge.
+ */
+class BatteryModel {
+public:
+    /**
+     * @brief Constructeur (pleine charge, température ambiante)
+     *
+     * @param tickMs Période d'appel de tick() (ms)
+     */
+    explicit BatteryModel(uint16_t tickMs);
+
+    /**
+     * @brief Remet la batterie à pleine charge, à l'ambiante
+     */
+    void reset();
+
+    /**
+     * @brief Intègre une période de décharge
+     *
+     * @param electricPower Commande électrique appliquée pendant le tick (Cv)
+     */
+    void tick(uint16_t electricPower);
+
+    /**
+     * @brief État de charge
+     *
+     * @return SoC (‰)
+     */
+    uint16_t getSoc() const;
+
+    /**
+     * @brief Puissance électrique disponible au prochain tick
+     *
+     * @return Plafond (Cv), 0 sous la réserve
+     */
+    uint16_t getPowerLimit() const;
+
+    /**
+     * @brief Autonomie restante à la puissance maximale disponible
+     *
+     * @return Durée de boost (s, saturée à 65535)
+     */
+    uint16_t getBoostTime() const;
+
+    /**
+     * @brief Tension aux bornes
+     *
+     * @return Tension (mV)
+     */
+    uint32_t getVoltage() const;
+
+    /**
+     * @brief Courant de décharge
+     *
+     * @return Courant (mA)
+     */
+    uint32_t getCurrent() const;
+
+    /**
+     * @brief Température du pack
+     *
+     * @return Température (0,1 °C)
+     */
+    int16_t getTemperature() const;
+
+private:
+    uint16_t tickMs_;          ///< Période d'intégration (ms)
+    uint64_t charge_;          ///< Charge restante (mA·ms)
+    int32_t temperature_;      ///< Température (µ°C)
+    uint32_t heatRemainder_;   ///< Pertes non encore converties en température (µJ)
+    uint32_t current_;         ///< Courant du dernier tick (mA)
+    uint32_t voltage_;         ///< Tension aux bornes du dernier tick (mV)
+    uint32_t maxCurrent_;      ///< Courant maximal disponible (mA)
+    uint16_t powerLimit_;      ///< Puissance disponible (Cv)
+    uint16_t soc_;             ///< État de charge (‰)
+
+    /**
+     * @brief Tension à vide pour la charge courante (mV)
+     */
+    uint32_t openCircuitVoltage() const;
+
+    /**
+     * @brief Recalcule SoC, courant maximal et puissance disponible
+     */
+    void updateLimits();
+};
+
+#endif // BATTERY_MODEL_H
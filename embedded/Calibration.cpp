@@ -0,0 +1,170 @@
+/**
+ * @file Calibration.cpp
+ * @brief Implémentation des courbes de calibration
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "Calibration.h"
+#include "PowerUnits.h"
+
+// ============================================================================
+// COURBES PAR DÉFAUT (FLASH)
+// ============================================================================
+
+namespace {
+    /** @brief Pas de grille des courbes par défaut (4096 Cv, un segment) */
+    constexpr uint8_t DEFAULT_SHIFT = 12U;
+
+    /**
+     * @brief Électrique par défaut: linéaire 100 % = 2200 W
+     *
+     * Placeholder tant que le banc moteur n'a pas fourni de mesures.
+     */
+    const uint32_t ELECTRIC_DEFAULT[] = {
+        0UL,
+        (4096UL * PowerUnits::FACTOR_W) / 100U
+    };
+
+    /**
+     * @brief Thermique par défaut: linéaire 100 % = 2200 W
+     *
+     * Placeholder tant que le banc turbine n'a pas fourni de mesures.
+     */
+    const uint32_t THERMAL_DEFAULT[] = {
+        0UL,
+        (4096UL * PowerUnits::FACTOR_W) / 100U
+    };
+
+    constexpr uint16_t DEFAULT_COUNT = sizeof(ELECTRIC_DEFAULT) / sizeof(ELECTRIC_DEFAULT[0]);
+
+    static_assert(sizeof(THERMAL_DEFAULT) == sizeof(ELECTRIC_DEFAULT),
+                  "Courbes par défaut de tailles différentes");
+
+    /** @brief Table de préparation (un chargement à la fois) */
+    uint32_t stage[CALIBRATION_MAX_POINTS];
+
+    /** @brief Courbe en cours de chargement (nullptr: aucune) */
+    const CalibrationCurve* stageOwner = nullptr;
+}
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+CalibrationCurve::CalibrationCurve(Source source)
+    : source_(source)
+    , points_(ELECTRIC_DEFAULT)
+    , count_(DEFAULT_COUNT)
+    , shift_(DEFAULT_SHIFT)
+    , revision_(0U)
+    , ram_()
+    , loadCount_(0U)
+    , loadIndex_(0U)
+    , loadShift_(0U)
+{
+    reset();
+}
+
+void CalibrationCurve::reset() {
+    points_ = (source_ == Source::THERMAL) ? THERMAL_DEFAULT : ELECTRIC_DEFAULT;
+    count_ = DEFAULT_COUNT;
+    shift_ = DEFAULT_SHIFT;
+    revision_++;
+    loadCount_ = 0U;
+}
+
+// ============================================================================
+// CHARGEMENT
+// ============================================================================
+
+bool CalibrationCurve::beginLoad(uint8_t shift, uint16_t count) {
+    // Un seul chargement à la fois: celui de l'autre source est abandonné
+    loadCount_ = 0U;
+    stageOwner = nullptr;
+
+    if ((shift > CALIBRATION_MAX_SHIFT) || (count < 2U) || (count > CALIBRATION_MAX_POINTS)) {
+        return false;
+    }
+
+    stageOwner = this;
+    loadShift_ = shift;
+    loadCount_ = count;
+    loadIndex_ = 0U;
+
+    return true;
+}
+
+bool CalibrationCurve::appendPoint(uint32_t watts) {
+    if ((stageOwner != this) || (loadCount_ == 0U) || (loadIndex_ >= loadCount_)) {
+        loadCount_ = 0U;
+        return false;
+    }
+
+    if (loadIndex_ > 0U) {
+        const uint32_t previous = stage[loadIndex_ - 1U];
+
+        // Croissante, et delta × (pas - 1) représentable sur int32
+        if ((watts < previous) || ((watts - previous) > (0x7FFFFFFFUL >> loadShift_))) {
+            loadCount_ = 0U;
+            return false;
+        }
+    }
+
+    stage[loadIndex_++] = watts;
+    return true;
+}
+
+bool CalibrationCurve::commitLoad() {
+    if ((stageOwner != this) || (loadCount_ == 0U) || (loadIndex_ != loadCount_)) {
+        loadCount_ = 0U;
+        return false;
+    }
+
+    // Lecture sur la table de préparation complète pendant la recopie
+    points_ = stage;
+    count_ = loadCount_;
+    shift_ = loadShift_;
+    for (uint16_t i = 0U; i < count_; i++) {
+        ram_[i] = stage[i];
+    }
+    points_ = ram_;
+
+    revision_++;
+    loadCount_ = 0U;
+    stageOwner = nullptr;
+
+    return true;
+}
+
+// ============================================================================
+// ACCESSEURS
+// ============================================================================
+
+CalibrationCurve::Source CalibrationCurve::getSource() const {
+    return source_;
+}
+
+uint16_t CalibrationCurve::getCount() const {
+    return count_;
+}
+
+uint16_t CalibrationCurve::getStep() const {
+    return static_cast<uint16_t>(1U << shift_);
+}
+
+uint8_t CalibrationCurve::getShift() const {
+    return shift_;
+}
+
+uint32_t CalibrationCurve::getPoint(uint16_t index) const {
+    return points_[(index < count_) ? index : (count_ - 1U)];
+}
+
+bool CalibrationCurve::isDefault() const {
+    return points_ != ram_;
+}
+
+uint16_t CalibrationCurve::getRevision() const {
+    return revision_;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file Crc.cpp
+ * @brief Implémentation du CRC-32
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "Crc.h"
+
+namespace {
+    /** @brief Polynôme réfléchi 0xEDB88320, par demi-octet */
+    const uint32_t NIBBLE_TABLE[16] = {
+        0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+        0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+        0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+        0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+    };
+}
+
+uint32_t Crc::crc32(const void* data, uint16_t size, uint32_t crc) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    crc = ~crc;
+    for (uint16_t i = 0U; i < size; i++) {
+        crc ^= bytes[i];
+        crc = (crc >> 4) ^ NIBBLE_TABLE[crc & 0x0FU];
+        crc = (crc >> 4) ^ NIBBLE_TABLE[crc & 0x0FU];
+    }
+    return ~crc;
+}
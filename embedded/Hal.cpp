@@ -0,0 +1,534 @@
+/**
+ * @file Hal.cpp
+ * @brief Implémentation de la couche d'abstraction matérielle
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "Hal.h"
+#include "config.h"
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#if defined(ARDUINO_ARCH_STM32)
+#include <IWatchdog.h>
+#include <EEPROM.h>
+#elif defined(__AVR__)
+#include <avr/wdt.h>
+#include <avr/sleep.h>
+#include <EEPROM.h>
+#endif
+#else
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// ============================================================================
+// TEMPS
+// ============================================================================
+
+uint32_t Hal::micros() {
+#if defined(ARDUINO)
+    return static_cast<uint32_t>(::micros());
+#else
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+#endif
+}
+
+// ============================================================================
+// SOMMEIL
+// ============================================================================
+
+namespace {
+    bool wakePending = false;   ///< Événement signalé, pas encore consommé
+    uint32_t wakeStamp = 0U;    ///< Horodatage du dernier événement (µs)
+
+#if !defined(ARDUINO)
+    std::mutex wakeMutex;                ///< Protège wakePending (host)
+    std::condition_variable wakeSignal;  ///< Réveil de sleep() (host)
+#endif
+}
+
+void Hal::sleep(uint32_t maxUs) {
+#if defined(ARDUINO_ARCH_STM32)
+    // Interruptions masquées entre le test et WFI: un wake() arrivant
+    // entre les deux reste en attente et réveille WFI aussitôt
+    (void)maxUs;
+    __disable_irq();
+    if (!__atomic_load_n(&wakePending, __ATOMIC_RELAXED)) {
+        __WFI();
+    }
+    __enable_irq();
+#elif defined(__AVR__)
+    // sei() suivi de sleep_cpu(): aucune interruption ne passe entre les deux
+    (void)maxUs;
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    cli();
+    if (!wakePending) {
+        sleep_enable();
+        sei();
+        sleep_cpu();
+        sleep_disable();
+    }
+    sei();
+#elif defined(ARDUINO)
+    (void)maxUs;
+#else
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    wakeSignal.wait_for(lock, std::chrono::microseconds(maxUs), [] { return wakePending; });
+#endif
+}
+
+void Hal::wake() {
+#if defined(ARDUINO)
+    __atomic_store_n(&wakeStamp, Hal::micros(), __ATOMIC_RELAXED);
+    __atomic_store_n(&wakePending, true, __ATOMIC_RELEASE);
+#else
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakeStamp = Hal::micros();
+        wakePending = true;
+    }
+    wakeSignal.notify_one();
+#endif
+}
+
+bool Hal::takeWake(uint32_t* stampUs) {
+#if defined(ARDUINO)
+    if (!__atomic_exchange_n(&wakePending, false, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    *stampUs = __atomic_load_n(&wakeStamp, __ATOMIC_RELAXED);
+    return true;
+#else
+    std::lock_guard<std::mutex> lock(wakeMutex);
+    if (!wakePending) {
+        return false;
+    }
+    wakePending = false;
+    *stampUs = wakeStamp;
+    return true;
+#endif
+}
+
+void Hal::wakeOnPin(uint8_t pin) {
+#if defined(ARDUINO)
+    const int interrupt = digitalPinToInterrupt(pin);
+    if (interrupt != NOT_AN_INTERRUPT) {
+        pinMode(pin, INPUT_PULLUP);
+        attachInterrupt(interrupt, Hal::wake, CHANGE);
+    }
+#else
+    (void)pin;
+#endif
+}
+
+// ============================================================================
+// RESET
+// ============================================================================
+
+Hal::ResetCause Hal::readResetCause() {
+#if defined(ARDUINO_ARCH_STM32)
+    if (IWatchdog.isReset(true)) {
+        return ResetCause::WATCHDOG;
+    }
+    if (__HAL_RCC_GET_FLAG(RCC_FLAG_SFTRST) != 0U) {
+        __HAL_RCC_CLEAR_RESET_FLAGS();
+        return ResetCause::SOFTWARE;
+    }
+    __HAL_RCC_CLEAR_RESET_FLAGS();
+    return ResetCause::POWER_ON;
+#elif defined(__AVR__)
+    const uint8_t flags = MCUSR;
+    MCUSR = 0U;
+    wdt_disable();
+    return ((flags & _BV(WDRF)) != 0U) ? ResetCause::WATCHDOG : ResetCause::POWER_ON;
+#else
+    return ResetCause::POWER_ON;
+#endif
+}
+
+// ============================================================================
+// WATCHDOG
+// ============================================================================
+
+void Hal::watchdogBegin(uint32_t timeoutMs) {
+#if defined(ARDUINO_ARCH_STM32)
+    IWatchdog.begin(timeoutMs * 1000UL);
+#elif defined(__AVR__)
+    // Pas le plus proche disponible par défaut sur AVR
+    (void)timeoutMs;
+    wdt_enable(WDTO_1S);
+#else
+    (void)timeoutMs;
+#endif
+}
+
+void Hal::watchdogKick() {
+#if defined(ARDUINO_ARCH_STM32)
+    IWatchdog.reload();
+#elif defined(__AVR__)
+    wdt_reset();
+#endif
+}
+
+// ============================================================================
+// LIAISON SÉRIE
+// ============================================================================
+
+#if !defined(ARDUINO)
+namespace {
+    /** @brief Tampon d'émission émulé (comme le cœur STM32) */
+    constexpr uint16_t HOST_SERIAL_BUFFER = 64U;
+
+    uint32_t serialBaudrate = 0UL;                        ///< Vitesse émulée (0 = non cadencé)
+    std::chrono::steady_clock::time_point serialIdleAt;   ///< Fin d'émission des octets remis
+}
+#endif
+
+void Hal::serialRate(uint32_t baudrate) {
+#if defined(ARDUINO)
+    (void)baudrate;
+#else
+    serialBaudrate = baudrate;
+    serialIdleAt = std::chrono::steady_clock::now();
+#endif
+}
+
+uint16_t Hal::serialRoom(uint16_t room) {
+#if defined(ARDUINO)
+    return room;
+#else
+    if (serialBaudrate == 0UL) {
+        return room;
+    }
+
+    // Octets encore « sur la ligne »: temps restant × débit
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    uint64_t pending = 0U;
+    if (serialIdleAt > now) {
+        const uint64_t remainingNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(serialIdleAt - now).count());
+        pending = (remainingNs * serialBaudrate + 9999999999ULL) / 10000000000ULL;
+    }
+
+    const uint16_t free = (pending < HOST_SERIAL_BUFFER) ? static_cast<uint16_t>(HOST_SERIAL_BUFFER - pending) : 0U;
+    return (room < free) ? room : free;
+#endif
+}
+
+void Hal::serialSent(uint16_t bytes) {
+#if defined(ARDUINO)
+    (void)bytes;
+#else
+    if (serialBaudrate == 0UL) {
+        return;
+    }
+
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (serialIdleAt < now) {
+        serialIdleAt = now;
+    }
+    serialIdleAt += std::chrono::nanoseconds((static_cast<uint64_t>(bytes) * 10000000000ULL) / serialBaudrate);
+#endif
+}
+
+// ============================================================================
+// VOIES DE PUISSANCE
+// ============================================================================
+
+#if !defined(ARDUINO)
+namespace {
+    const Hal::Plant* attachedPlant = nullptr;  ///< Procédé simulé (host)
+}
+
+void Hal::attachPlant(const Plant* plant) {
+    attachedPlant = plant;
+}
+#endif
+
+void Hal::writePower(uint8_t channel, uint16_t power) {
+#if defined(ARDUINO)
+    // Pas encore d'actionneur câblé: la commande part sur le flux ARINC
+    (void)channel;
+    (void)power;
+#else
+    if (attachedPlant != nullptr) {
+        attachedPlant->write(attachedPlant->context, channel, power);
+    }
+#endif
+}
+
+bool Hal::readPower(uint8_t channel, uint16_t* power) {
+#if defined(ARDUINO)
+    // Pas encore de capteur câblé: boucle ouverte
+    (void)channel;
+    (void)power;
+    return false;
+#else
+    return (attachedPlant != nullptr) && attachedPlant->read(attachedPlant->context, channel, power);
+#endif
+}
+
+// ============================================================================
+// STOCKAGE NON VOLATIL
+// ============================================================================
+
+#if !defined(ARDUINO)
+namespace {
+    /** @brief Taille de l'EEPROM par défaut (émulation STM32F103: une page de 1 Ko) */
+    constexpr uint32_t HOST_NV_SIZE = 1024UL;
+
+    /** @brief Page effaçable host (comme le F103) */
+    constexpr uint32_t HOST_PAGE_SIZE = 1024UL;
+
+    /** @brief Zone de pages, à la suite de l'EEPROM dans le fichier */
+    constexpr uint32_t HOST_PAGE_AREA = JOURNAL_FLASH_PAGES * HOST_PAGE_SIZE;
+
+    uint8_t* storage = nullptr;   ///< Fichier projeté (host)
+    uint32_t storageSize = 0UL;   ///< Taille de l'EEPROM projetée (octets)
+
+    void openDefaultStorage() {
+        if (storage == nullptr) {
+            const char* path = getenv("VOLTE_NV_FILE");
+            Hal::attachStorage((path != nullptr) ? path : "volte_nv.bin", HOST_NV_SIZE);
+        }
+    }
+}
+
+bool Hal::attachStorage(const char* path, uint32_t size) {
+    detachStorage();
+
+    const int fd = ::open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    const uint32_t total = size + HOST_PAGE_AREA;
+    struct stat info;
+    const uint32_t previous = (fstat(fd, &info) == 0) ? static_cast<uint32_t>(info.st_size) : 0UL;
+    if ((previous < total) && (ftruncate(fd, static_cast<off_t>(total)) != 0)) {
+        ::close(fd);
+        return false;
+    }
+
+    void* map = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+
+    storage = static_cast<uint8_t*>(map);
+    storageSize = size;
+    if (previous < total) {
+        // Zone neuve: état effacé d'une flash
+        memset(storage + previous, 0xFF, total - previous);
+    }
+    return true;
+}
+
+void Hal::detachStorage() {
+    if (storage != nullptr) {
+        munmap(storage, storageSize + HOST_PAGE_AREA);
+        storage = nullptr;
+        storageSize = 0UL;
+    }
+}
+#endif
+
+uint32_t Hal::nvBegin() {
+#if defined(ARDUINO_ARCH_STM32)
+    eeprom_buffer_fill();
+    return E2END + 1UL;
+#elif defined(__AVR__)
+    return E2END + 1UL;
+#elif defined(ARDUINO)
+    return 0UL;
+#else
+    openDefaultStorage();
+    return storageSize;
+#endif
+}
+
+void Hal::nvRead(uint32_t offset, void* data, uint16_t size) {
+    uint8_t* bytes = static_cast<uint8_t*>(data);
+
+    for (uint16_t i = 0U; i < size; i++) {
+        const uint32_t address = offset + i;
+#if defined(ARDUINO_ARCH_STM32)
+        bytes[i] = (address <= E2END) ? eeprom_buffered_read_byte(address) : 0xFFU;
+#elif defined(__AVR__)
+        bytes[i] = (address <= E2END) ? EEPROM.read(static_cast<int>(address)) : 0xFFU;
+#elif defined(ARDUINO)
+        (void)address;
+        bytes[i] = 0xFFU;
+#else
+        bytes[i] = (address < storageSize) ? storage[address] : 0xFFU;
+#endif
+    }
+}
+
+void Hal::nvWrite(uint32_t offset, const void* data, uint16_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    for (uint16_t i = 0U; i < size; i++) {
+        const uint32_t address = offset + i;
+#if defined(ARDUINO_ARCH_STM32)
+        if (address <= E2END) {
+            eeprom_buffered_write_byte(address, bytes[i]);
+        }
+#elif defined(__AVR__)
+        // update(): pas d'écriture si l'octet est inchangé (usure)
+        if (address <= E2END) {
+            EEPROM.update(static_cast<int>(address), bytes[i]);
+        }
+#elif defined(ARDUINO)
+        (void)address;
+        (void)bytes;
+#else
+        if (address < storageSize) {
+            storage[address] = bytes[i];
+        }
+#endif
+    }
+}
+
+void Hal::nvCommit() {
+#if defined(ARDUINO_ARCH_STM32)
+    eeprom_buffer_flush();
+#elif !defined(ARDUINO)
+    // Mapping partagé: les données survivent à l'arrêt du processus,
+    // msync() asynchrone pour ne pas bloquer la boucle
+    if (storage != nullptr) {
+        msync(storage, storageSize + HOST_PAGE_AREA, MS_ASYNC);
+    }
+#endif
+}
+
+// ============================================================================
+// PAGES FLASH
+// ============================================================================
+
+#if defined(ARDUINO_ARCH_STM32) && defined(FLASH_PAGE_SIZE) \
+    && (defined(STM32F0xx) || defined(STM32F1xx) || defined(STM32F3xx))
+#define HAL_FLASH_PAGES 1
+
+// Fin de l'image programme (scripts de lien stm32duino)
+extern "C" uint32_t _sidata;
+extern "C" uint32_t _sdata;
+extern "C" uint32_t _edata;
+
+namespace {
+#if defined(FLASH_BASE_ADDRESS)
+    constexpr uint32_t EEPROM_PAGE = FLASH_BASE_ADDRESS;
+#else
+    constexpr uint32_t EEPROM_PAGE = FLASH_END + 1UL - FLASH_PAGE_SIZE;
+#endif
+
+    /** @brief Zone de pages, juste sous la page d'émulation EEPROM */
+    constexpr uint32_t PAGE_AREA = JOURNAL_FLASH_PAGES * FLASH_PAGE_SIZE;
+    constexpr uint32_t PAGE_BASE = EEPROM_PAGE - PAGE_AREA;
+}
+#endif
+
+uint32_t Hal::pageBegin() {
+#if defined(HAL_FLASH_PAGES)
+    // Données initialisées copiées depuis la flash: fin réelle du programme
+    const uint32_t imageEnd = reinterpret_cast<uint32_t>(&_sidata)
+        + (reinterpret_cast<uint32_t>(&_edata) - reinterpret_cast<uint32_t>(&_sdata));
+    return (imageEnd <= PAGE_BASE) ? PAGE_AREA : 0UL;
+#elif defined(ARDUINO)
+    return 0UL;
+#else
+    openDefaultStorage();
+    return (storage != nullptr) ? HOST_PAGE_AREA : 0UL;
+#endif
+}
+
+uint32_t Hal::pageSize() {
+#if defined(HAL_FLASH_PAGES)
+    return FLASH_PAGE_SIZE;
+#elif defined(ARDUINO)
+    return 0UL;
+#else
+    return HOST_PAGE_SIZE;
+#endif
+}
+
+void Hal::pageRead(uint32_t offset, void* data, uint16_t size) {
+    uint8_t* bytes = static_cast<uint8_t*>(data);
+
+    for (uint16_t i = 0U; i < size; i++) {
+        const uint32_t address = offset + i;
+#if defined(HAL_FLASH_PAGES)
+        bytes[i] = (address < PAGE_AREA) ? *reinterpret_cast<const volatile uint8_t*>(PAGE_BASE + address) : 0xFFU;
+#elif defined(ARDUINO)
+        (void)address;
+        bytes[i] = 0xFFU;
+#else
+        bytes[i] = ((storage != nullptr) && (address < HOST_PAGE_AREA)) ? storage[storageSize + address] : 0xFFU;
+#endif
+    }
+}
+
+void Hal::pageErase(uint32_t offset) {
+#if defined(HAL_FLASH_PAGES)
+    if (offset >= PAGE_AREA) {
+        return;
+    }
+
+    FLASH_EraseInitTypeDef erase = {};
+    erase.TypeErase = FLASH_TYPEERASE_PAGES;
+    erase.PageAddress = PAGE_BASE + (offset - (offset % FLASH_PAGE_SIZE));
+    erase.NbPages = 1U;
+    uint32_t error = 0UL;
+
+    HAL_FLASH_Unlock();
+    HAL_FLASHEx_Erase(&erase, &error);
+    HAL_FLASH_Lock();
+#elif defined(ARDUINO)
+    (void)offset;
+#else
+    if ((storage != nullptr) && (offset < HOST_PAGE_AREA)) {
+        memset(storage + storageSize + (offset - (offset % HOST_PAGE_SIZE)), 0xFF, HOST_PAGE_SIZE);
+    }
+#endif
+}
+
+void Hal::pageWrite(uint32_t offset, const void* data, uint16_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+#if defined(HAL_FLASH_PAGES)
+    HAL_FLASH_Unlock();
+    for (uint16_t i = 0U; i < size; i = static_cast<uint16_t>(i + 2U)) {
+        const uint32_t address = offset + i;
+        if (address + 1UL < PAGE_AREA) {
+            const uint16_t high = (i + 1U < size) ? bytes[i + 1U] : 0xFFU;
+            HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, PAGE_BASE + address,
+                              static_cast<uint16_t>(bytes[i] | (high << 8)));
+        }
+    }
+    HAL_FLASH_Lock();
+#elif defined(ARDUINO)
+    (void)offset;
+    (void)bytes;
+    (void)size;
+#else
+    // Comme la flash: la programmation ne fait que passer des bits à 0
+    for (uint16_t i = 0U; i < size; i++) {
+        const uint32_t address = offset + i;
+        if ((storage != nullptr) && (address < HOST_PAGE_AREA)) {
+            storage[storageSize + address] &= bytes[i];
+        }
+    }
+#endif
+}
@@ -0,0 +1,276 @@
+/**
+ * @file Hal.h
+ * @brief Couche d'abstraction matérielle minimale (temps, sommeil, watchdog, reset, puissance, stockage)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Isole les quelques accès dépendants de la cible pour que les modules
+ * de calcul restent compilables sur PC (build host, sans ARDUINO défini).
+ */
+
+#ifndef HAL_H
+#define HAL_H
+
+#include <stdint.h>
+
+/**
+ * @brief Place une variable hors de la zone initialisée au démarrage
+ *
+ * Le contenu survit à un reset watchdog/logiciel (pas à une coupure
+ * d'alimentation). Sans effet sur les builds host.
+ */
+#if defined(ARDUINO)
+#define HAL_NOINIT __attribute__((section(".noinit")))
+#else
+#define HAL_NOINIT
+#endif
+
+/**
+ * @brief Fonctions d'accès matériel
+ */
+namespace Hal {
+
+    /**
+     * @brief Cause du dernier reset
+     */
+    enum class ResetCause : uint8_t {
+        POWER_ON = 0U,   ///< Mise sous tension / reset externe
+        WATCHDOG = 1U,   ///< Expiration du watchdog
+        SOFTWARE = 2U    ///< Reset logiciel
+    };
+
+    /**
+     * @brief Temps écoulé depuis le démarrage (µs, rebouclage ~71 min)
+     *
+     * Utilisable en contexte interruption.
+     *
+     * @return Horodatage en microsecondes
+     */
+    uint32_t micros();
+
+    /**
+     * @brief Met le cœur en veille jusqu'à la prochaine interruption
+     *
+     * STM32: WFI (réveil au plus tard par le SysTick, 1 ms). AVR: mode
+     * IDLE (réveil par le timer 0). Host: attente bloquante d'un wake(),
+     * bornée par maxUs. Retour immédiat si un wake() est en attente.
+     *
+     * @param maxUs Durée maximale (µs, utilisée par le host)
+     */
+    void sleep(uint32_t maxUs);
+
+    /**
+     * @brief Signale un événement à traiter (interruption, thread host)
+     *
+     * Horodate l'événement et interrompt sleep().
+     */
+    void wake();
+
+    /**
+     * @brief Consomme le dernier événement signalé par wake()
+     *
+     * @param stampUs Horodatage de l'événement (µs), écrit si présent
+     * @return false si aucun événement n'est en attente
+     */
+    bool takeWake(uint32_t* stampUs);
+
+    /**
+     * @brief Configure une broche d'entrée comme source de réveil
+     *
+     * Entrée avec pull-up, wake() sur chaque front. Sans effet si la
+     * broche n'a pas d'interruption (AVR: broches 2 et 3) ou en host.
+     *
+     * @param pin Broche Arduino
+     */
+    void wakeOnPin(uint8_t pin);
+
+    /**
+     * @brief Lit puis acquitte la cause du dernier reset
+     *
+     * À appeler une seule fois, au démarrage.
+     *
+     * @return Cause du reset
+     */
+    ResetCause readResetCause();
+
+    /**
+     * @brief Arme le watchdog indépendant
+     *
+     * @param timeoutMs Délai avant reset (ms)
+     */
+    void watchdogBegin(uint32_t timeoutMs);
+
+    /**
+     * @brief Recharge le watchdog (à appeler à chaque tour de boucle)
+     */
+    void watchdogKick();
+
+    /**
+     * @brief Déclare la vitesse de la liaison série
+     *
+     * Cible: sans effet, l'UART impose son débit. Host: l'émission est
+     * cadencée à cette vitesse (10 bits par octet, tampon de 64 octets)
+     * pour que les mesures de débit suivent la vitesse négociée.
+     *
+     * @param baudrate Vitesse (bps)
+     */
+    void serialRate(uint32_t baudrate);
+
+    /**
+     * @brief Octets émissibles maintenant
+     *
+     * @param room Place libre annoncée par l'UART
+     * @return room sur cible ; bornée par l'UART émulé sur host
+     */
+    uint16_t serialRoom(uint16_t room);
+
+    /**
+     * @brief Compte les octets remis à l'UART (host: UART émulé)
+     *
+     * @param bytes Octets écrits
+     */
+    void serialSent(uint16_t bytes);
+
+    /**
+     * @brief Transmet une commande de puissance à l'actionneur d'une voie
+     *
+     * Cible: pas encore de sortie (PWM/CAN à définir). Host: procédé
+     * simulé attaché par attachPlant().
+     *
+     * @param channel Voie (rang de PowerAllocator::Source)
+     * @param power Commande (Cv)
+     */
+    void writePower(uint8_t channel, uint16_t power);
+
+    /**
+     * @brief Lit la puissance délivrée mesurée sur une voie
+     *
+     * @param channel Voie (rang de PowerAllocator::Source)
+     * @param power Mesure (Cv), écrite si la lecture réussit
+     * @return false si aucun capteur n'est disponible
+     */
+    bool readPower(uint8_t channel, uint16_t* power);
+
+    /**
+     * @brief Ouvre la mémoire non volatile
+     *
+     * Cible STM32: EEPROM émulée du cœur, recopiée en RAM (API
+     * bufferisée). AVR: EEPROM interne. Host: fichier projeté en mémoire
+     * (attachStorage(), sinon $VOLTE_NV_FILE ou "volte_nv.bin", 1 Ko
+     * comme la page d'émulation du F103).
+     *
+     * @return Taille utilisable (octets), 0 si indisponible
+     */
+    uint32_t nvBegin();
+
+    /**
+     * @brief Lit la mémoire non volatile (0xFF hors zone, comme une flash effacée)
+     *
+     * @param offset Adresse (octets)
+     * @param data Destination
+     * @param size Taille (octets)
+     */
+    void nvRead(uint32_t offset, void* data, uint16_t size);
+
+    /**
+     * @brief Écrit la mémoire non volatile (durable après nvCommit())
+     *
+     * @param offset Adresse (octets)
+     * @param data Source
+     * @param size Taille (octets), ignorée hors zone
+     */
+    void nvWrite(uint32_t offset, const void* data, uint16_t size);
+
+    /**
+     * @brief Rend durables les écritures en attente
+     *
+     * STM32: effacement puis programmation de la page d'émulation
+     * (bloquant, plusieurs ms). AVR: sans effet (écriture directe).
+     */
+    void nvCommit();
+
+    /**
+     * @brief Ouvre les pages flash réservées aux enregistrements volumineux
+     *
+     * Zone distincte de l'EEPROM émulée (une page de 1 Ko sur F103), écrite
+     * directement sans copie en RAM. STM32 à pages uniformes (F0/F1/F3):
+     * JOURNAL_FLASH_PAGES pages juste sous la page d'émulation, refusées si
+     * le programme les recouvre. Host: à la suite de l'EEPROM dans le
+     * fichier projeté. Autres cibles: aucune.
+     *
+     * @return Taille de la zone (octets), 0 si indisponible
+     */
+    uint32_t pageBegin();
+
+    /**
+     * @brief Taille d'une page effaçable (octets, 0 sans zone de pages)
+     */
+    uint32_t pageSize();
+
+    /**
+     * @brief Lit la zone de pages (0xFF hors zone)
+     *
+     * @param offset Adresse dans la zone (octets)
+     * @param data Destination
+     * @param size Taille (octets)
+     */
+    void pageRead(uint32_t offset, void* data, uint16_t size);
+
+    /**
+     * @brief Efface la page contenant une adresse (bloquant, ~20 ms sur F103)
+     *
+     * @param offset Adresse dans la zone (octets)
+     */
+    void pageErase(uint32_t offset);
+
+    /**
+     * @brief Programme des octets effacés de la zone de pages (durable au retour)
+     *
+     * Programmation par demi-mots: offset pair ; un dernier octet impair
+     * est complété par 0xFF. Un bit déjà programmé ne revient à 1 que par
+     * pageErase().
+     *
+     * @param offset Adresse dans la zone (octets, paire)
+     * @param data Source
+     * @param size Taille (octets), ignorée hors zone
+     */
+    void pageWrite(uint32_t offset, const void* data, uint16_t size);
+
+#if !defined(ARDUINO)
+    /**
+     * @brief Procédé simulé branché sur les voies de puissance (host)
+     */
+    struct Plant {
+        void (*write)(void* context, uint8_t channel, uint16_t power);   ///< Commande reçue
+        bool (*read)(void* context, uint8_t channel, uint16_t* power);   ///< Mesure demandée
+        void* context;                                                   ///< Instance du procédé
+    };
+
+    /**
+     * @brief Attache un procédé simulé (nullptr pour détacher)
+     *
+     * @param plant Procédé (doit survivre à l'attachement)
+     */
+    void attachPlant(const Plant* plant);
+
+    /**
+     * @brief Projette un fichier comme mémoire non volatile (host)
+     *
+     * Le fichier est créé ou agrandi à la taille demandée plus la zone de
+     * pages (JOURNAL_FLASH_PAGES x 1 Ko), complété par 0xFF (flash
+     * effacée). Remplace le stockage précédent.
+     *
+     * @param path Chemin du fichier
+     * @param size Taille de l'EEPROM émulée (octets)
+     * @return false si le fichier ne peut pas être projeté
+     */
+    bool attachStorage(const char* path, uint32_t size);
+
+    /**
+     * @brief Libère le fichier projeté (équivalent host d'une coupure)
+     */
+    void detachStorage();
+#endif
+}
+
+#endif // HAL_H
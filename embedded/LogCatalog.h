@@ -0,0 +1,73 @@
+/**
+ * @file LogCatalog.h
+ * @brief Catalogue des messages de diagnostic (journalisation différée)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Source unique des chaînes de format. En mode différé (LOG_DEFERRED = 1)
+ * le firmware n'émet que l'identifiant et les arguments bruts ; l'outil
+ * tools/log_decoder.py relit ce fichier pour reconstruire le texte.
+ *
+ * Règles:
+ * - Ajouter les nouveaux messages EN FIN de liste (l'identifiant = rang)
+ * - Conversions supportées: %u (décimal), %x (hexa), %c (caractère),
+ *   %M (nom du mode de vol), %% (caractère %)
+ * - Un message par ligne, format "X(NOM, "texte")"
+ */
+
+#ifndef LOG_CATALOG_H
+#define LOG_CATALOG_H
+
+#include <stdint.h>
+
+#define LOG_CATALOG(X) \
+    X(CMD_MODE,            "\n[CMD] Changement mode → %M") \
+    X(CMD_POWER_UP,        "\n[CMD] Puissance +%u Cv") \
+    X(CMD_POWER_DOWN,      "\n[CMD] Puissance -%u Cv") \
+    X(CMD_POWER_SET,       "\n[CMD] Puissance définie: %u Cv") \
+    X(CMD_STATUS,          "\n[CMD] Status système complet") \
+    X(CMD_TRACE_DUMP,      "\n[CMD] Vidange boîte noire") \
+    X(CMD_RESET,           "\n[CMD] Reset système...") \
+    X(WARN_UNKNOWN_CMD,    "\n[WARN] Commande inconnue: %c") \
+    X(WARN_WATCHDOG_RESET, "[WARN] Reset watchdog détecté - vidange boîte noire") \
+    X(ERROR_NEGATIVE,      "\n[ERROR] Valeur négative invalide") \
+    X(ERROR_TOO_LARGE,     "\n[ERROR] Valeur trop grande (max %u)") \
+    X(SYSTEM_RESET_DONE,   "[SYSTEM] Reset complet - Mode %M - %u Cv") \
+    X(SYSTEM_READY,        "[SYSTEM] Système opérationnel\n") \
+    X(CMD_CALIBRATION,     "\n[CMD] Calibration %u chargée: %u points, pas %u Cv") \
+    X(ERROR_CALIBRATION,   "\n[ERROR] Calibration rejetée (champ %u)") \
+    X(CMD_ARINC_STREAM,    "\n[CMD] Flux ARINC périodique: %u") \
+    X(CMD_SPOOL_COMPENSATION, "\n[CMD] Compensation retard turbine: %u") \
+    X(CMD_SCHEDULE,        "\n[CMD] Programme de vol: %u") \
+    X(SCHEDULE_STEP,       "[SCHEDULE] Étape %u/%u - Mode %M - %u Cv") \
+    X(SCHEDULE_SUSPENDED,  "[SCHEDULE] Suspendu à l'étape %u (commande opérateur, 'g' pour reprendre)") \
+    X(SCHEDULE_DONE,       "[SCHEDULE] Programme terminé") \
+    X(SCHEDULE_STATUS,     "[SCHEDULE] État %u - étape %u/%u - reste %u s") \
+    X(ERROR_SCHEDULE,      "\n[ERROR] Aucun programme à lancer ou reprendre") \
+    X(CMD_USAGE,           "\n[CMD] Statistiques d'utilisation") \
+    X(CMD_METRICS,         "\n[CMD] Métriques de santé") \
+    X(SYSTEM_BOOT_TIME,    "[SYSTEM] Première commande valide %u µs après le reset") \
+    X(JOURNAL_RESTORED,    "[SYSTEM] État restauré - Mode %M - %u Cv (enregistrement %u)") \
+    X(WARN_JOURNAL_UNAVAILABLE, "[WARN] Stockage non volatil indisponible - état non persistant") \
+    X(CMD_LIMITS,          "\n[CMD] Limites validées (CRC %x), échange au prochain tick") \
+    X(ERROR_LIMITS,        "\n[ERROR] Limites rejetées (champ %u)") \
+    X(LIMITS_APPLIED,      "[SYSTEM] Limites actives: génération %u") \
+    X(LINK_ACK,            "\n[LINK] ACK %u bps, ping attendu sous %u ms") \
+    X(LINK_PONG,           "[LINK] PONG %u bps | nonce %u | CRC %x") \
+    X(LINK_FALLBACK,       "\n[LINK] Échec à %u bps, retour à %u bps") \
+    X(ERROR_LINK,          "\n[ERROR] Négociation rejetée (champ %u)") \
+    X(WARN_CALIBRATION_VOLATILE, "[WARN] Pages flash de calibration indisponibles - courbes non persistantes") \
+    X(LINK_CONFIRMED,      "[LINK] OK %u bps confirmée des deux côtés") \
+    X(WARN_SCHEDULE_REJECTED, "[WARN] Programme de vol rejeté (étape hors limites du mode)")
+
+/**
+ * @brief Identifiants des messages (rang dans LOG_CATALOG)
+ */
+enum class LogId : uint8_t {
+#define LOG_CATALOG_ID(name, format) name,
+    LOG_CATALOG(LOG_CATALOG_ID)
+#undef LOG_CATALOG_ID
+    COUNT
+};
+
+#endif // LOG_CATALOG_H
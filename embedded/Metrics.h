@@ -0,0 +1,106 @@
+/**
+ * @file Metrics.h
+ * @brief Registre de compteurs et jauges de santé (diagnostic terrain)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Un mot 32 bits par métrique, accès atomiques relâchés: un incrément
+ * coûte une instruction, utilisable depuis une interruption comme depuis
+ * loop(). Lecture par la commande 'm' et résumé compacté dans le mot
+ * ARINC_LABEL_SYSTEM_STATUS.
+ *
+ * Règles:
+ * - Ajouter les nouvelles métriques EN FIN de liste (l'identifiant = rang)
+ * - Un élément par ligne, format "X(NOM, "libellé")"
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+
+#define METRICS_CATALOG(X) \
+    X(LOOP_RATE,      "boucles/s") \
+    X(LOOP_MAX_US,    "boucle max (µs)") \
+    X(BYTES_TX,       "octets TX") \
+    X(BYTES_RX,       "octets RX") \
+    X(TX_QUEUE,       "file TX max (octets)") \
+    X(FRAMES_DROPPED, "écritures perdues") \
+    X(COMMANDS,       "commandes traitées") \
+    X(PARSE_ERRORS,   "erreurs de saisie") \
+    X(BOOT_US,        "reset → 1re commande (µs)") \
+    X(JOURNAL_COMMITS, "validations du journal") \
+    X(DUTY_CYCLE,     "charge CPU (‰)") \
+    X(WAKE_LATENCY_US, "latence réveil max (µs)")
+
+namespace Metrics {
+
+    /**
+     * @brief Identifiants des métriques (rang dans METRICS_CATALOG)
+     */
+    enum class Id : uint8_t {
+#define METRICS_CATALOG_ID(name, label) name,
+        METRICS_CATALOG(METRICS_CATALOG_ID)
+#undef METRICS_CATALOG_ID
+        COUNT
+    };
+
+    /** @brief Nombre de métriques */
+    constexpr uint8_t COUNT = static_cast<uint8_t>(Id::COUNT);
+
+    /** @brief Valeurs (définies dans Metrics.cpp) */
+    extern uint32_t values[COUNT];
+
+    /**
+     * @brief Incrémente un compteur (ISR-safe)
+     */
+    inline void add(Id id, uint32_t amount = 1U) {
+        __atomic_fetch_add(&values[static_cast<uint8_t>(id)], amount, __ATOMIC_RELAXED);
+    }
+
+    /**
+     * @brief Fixe une jauge
+     */
+    inline void set(Id id, uint32_t value) {
+        __atomic_store_n(&values[static_cast<uint8_t>(id)], value, __ATOMIC_RELAXED);
+    }
+
+    /**
+     * @brief Retient le maximum d'une jauge (écrivain unique: loop())
+     */
+    inline void peak(Id id, uint32_t value) {
+        if (value > __atomic_load_n(&values[static_cast<uint8_t>(id)], __ATOMIC_RELAXED)) {
+            __atomic_store_n(&values[static_cast<uint8_t>(id)], value, __ATOMIC_RELAXED);
+        }
+    }
+
+    /**
+     * @brief Valeur courante
+     */
+    inline uint32_t get(Id id) {
+        return __atomic_load_n(&values[static_cast<uint8_t>(id)], __ATOMIC_RELAXED);
+    }
+
+    /**
+     * @brief Libellé d'une métrique
+     */
+    const char* labelOf(Id id);
+
+    /**
+     * @brief Remet toutes les métriques à zéro
+     */
+    void reset();
+
+    /**
+     * @brief Compacte l'état de santé dans un mot 32 bits
+     *
+     * [31:24] boucles/s / 100, [23:16] boucle max (100 µs),
+     * [15:8] file TX max (octets), [7:4] écritures perdues et
+     * [3:0] erreurs de saisie depuis le mot précédent ; champs saturés.
+     *
+     * @return Mot ARINC_LABEL_SYSTEM_STATUS
+     */
+    uint32_t packStatus();
+}
+
+#endif // METRICS_H
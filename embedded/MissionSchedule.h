@@ -0,0 +1,34 @@
+/**
+ * @file MissionSchedule.h
+ * @brief Programme de vol de démonstration (table en flash)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Profil décollage / montée / croisière / descente / approche de
+ * tools/plant_sim.cpp, réparti par tools/mission_optimizer.cpp:
+ *   ./mission_optimizer - programme.inc
+ * puis coller les lignes générées ci-dessous. À inclure une seule fois
+ * (PowerManagement.ino).
+ */
+
+#ifndef MISSION_SCHEDULE_H
+#define MISSION_SCHEDULE_H
+
+#include <stdint.h>
+#include "SchedulePlayer.h"
+
+/** @brief Étapes { durée s, mode, total Cv, électrique Cv } */
+const SchedulePlayer::Entry MISSION_SCHEDULE[] = {
+    {    60U, 0U, 3250U, 1000U },   // Décollage
+    {    30U, 0U, 2800U,  950U },   // Montée
+    {   870U, 0U, 2800U, 1000U },
+    {  3600U, 1U, 2000U,    0U },   // Croisière
+    {   900U, 1U,  800U,    0U },   // Descente
+    {   280U, 2U, 1500U,  125U },   // Approche
+    {    20U, 2U, 1500U,  400U }
+};
+
+/** @brief Nombre d'étapes */
+const uint16_t MISSION_SCHEDULE_COUNT = sizeof(MISSION_SCHEDULE) / sizeof(MISSION_SCHEDULE[0]);
+
+#endif // MISSION_SCHEDULE_H
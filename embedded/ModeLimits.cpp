@@ -0,0 +1,168 @@
+/**
+ * @file ModeLimits.cpp
+ * @brief Implémentation des limites par mode modifiables en vol
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "ModeLimits.h"
+#include "config.h"
+#include "Crc.h"
+
+namespace ModeLimits {
+
+    const Table DEFAULTS = {{
+        {
+            DecollageConfig::MIN_POWER, DecollageConfig::MAX_POWER, DecollageConfig::INITIAL_POWER,
+            DecollageConfig::ELECTRIC_MAX, DecollageConfig::THERMAL_MAX,
+            DecollageConfig::ELECTRIC_RAMP_UP, DecollageConfig::ELECTRIC_RAMP_DOWN,
+            DecollageConfig::THERMAL_RAMP_UP, DecollageConfig::THERMAL_RAMP_DOWN
+        },
+        {
+            NormalConfig::MIN_POWER, NormalConfig::MAX_POWER, NormalConfig::INITIAL_POWER,
+            0U, NormalConfig::THERMAL_MAX,
+            NormalConfig::ELECTRIC_RAMP_UP, NormalConfig::ELECTRIC_RAMP_DOWN,
+            NormalConfig::THERMAL_RAMP_UP, NormalConfig::THERMAL_RAMP_DOWN
+        },
+        {
+            UrgenceConfig::MIN_POWER, UrgenceConfig::MAX_POWER, UrgenceConfig::INITIAL_POWER,
+            UrgenceConfig::ELECTRIC_MAX, UrgenceConfig::THERMAL_MAX,
+            UrgenceConfig::ELECTRIC_RAMP_UP, UrgenceConfig::ELECTRIC_RAMP_DOWN,
+            UrgenceConfig::THERMAL_RAMP_UP, UrgenceConfig::THERMAL_RAMP_DOWN
+        }
+    }};
+
+    const Table* activeTable = &DEFAULTS;
+
+    namespace {
+        /** @brief Champs de Limits dans l'ordre du protocole */
+        uint16_t Limits::* const FIELDS[FIELDS_PER_MODE] = {
+            &Limits::minPower, &Limits::maxPower, &Limits::initialPower,
+            &Limits::electricMax, &Limits::thermalMax,
+            &Limits::electricRampUp, &Limits::electricRampDown,
+            &Limits::thermalRampUp, &Limits::thermalRampDown
+        };
+
+        Table banks[2];            ///< Tampons RAM (l'un actif, l'autre en édition)
+        Table* shadow = nullptr;   ///< Tampon en édition, nullptr si aucune
+        bool pending = false;      ///< Tampon validé, échange au prochain commit()
+        uint16_t generation = 0U;  ///< Échanges publiés
+    }
+
+    // ========================================================================
+    // ÉDITION (hors chaîne de contrôle)
+    // ========================================================================
+
+    void beginEdit() {
+        // Tampon inactif: jamais lu par la chaîne de contrôle
+        const Table* current = activeTable;
+        pending = false;
+        shadow = (current == &banks[0]) ? &banks[1] : &banks[0];
+        *shadow = *current;
+    }
+
+    bool setField(uint8_t index, uint16_t value) {
+        if ((shadow == nullptr) || (index >= FIELD_COUNT)) {
+            return false;
+        }
+
+        shadow->mode[index / FIELDS_PER_MODE].*FIELDS[index % FIELDS_PER_MODE] = value;
+        return true;
+    }
+
+    uint8_t stage(uint32_t crc) {
+        if (shadow == nullptr) {
+            return 0U;
+        }
+
+        // CRC d'abord: une ligne tronquée ou altérée est rejetée en bloc
+        if (crcOf(*shadow) != crc) {
+            shadow = nullptr;
+            return FIELD_COUNT;
+        }
+
+        const uint8_t invalid = validate(*shadow);
+        if (invalid != FIELD_COUNT) {
+            shadow = nullptr;
+            return invalid;
+        }
+
+        pending = true;
+        return STAGED;
+    }
+
+    // ========================================================================
+    // PUBLICATION (frontière de tick)
+    // ========================================================================
+
+    bool commit() {
+        if (!pending) {
+            return false;
+        }
+
+        __atomic_store_n(&activeTable, shadow, __ATOMIC_RELEASE);
+        shadow = nullptr;
+        pending = false;
+        generation++;
+        return true;
+    }
+
+    uint16_t getGeneration() {
+        return generation;
+    }
+
+    // ========================================================================
+    // CONTRÔLES
+    // ========================================================================
+
+    // Consigne thermique ≤ thermalMax ≤ PLANT_MAX_POWER: l'état Q16.16 de TurbineSpool tient aussi en int32_t
+    static_assert((static_cast<uint32_t>(PLANT_MAX_POWER) << 16) <= 0x7FFFFFFFUL,
+                  "PLANT_MAX_POWER hors de l'état Q16.16 de TurbineSpool");
+
+    uint8_t validate(const Table& table) {
+        for (uint8_t m = 0U; m < PowerDistribution::MODE_COUNT; m++) {
+            const Limits& limits = table.mode[m];
+            const uint8_t base = m * FIELDS_PER_MODE;
+
+            if (limits.minPower > limits.maxPower) {
+                return base;
+            }
+            if (limits.maxPower > PLANT_MAX_POWER) {
+                return base + 1U;
+            }
+            if ((limits.initialPower < limits.minPower) || (limits.initialPower > limits.maxPower)) {
+                return base + 2U;
+            }
+            if (limits.electricMax > BATTERY_MAX_POWER) {
+                return base + 3U;
+            }
+            if (limits.thermalMax > PLANT_MAX_POWER) {
+                return base + 4U;
+            }
+            if (static_cast<uint32_t>(limits.maxPower) > static_cast<uint32_t>(limits.electricMax) + limits.thermalMax) {
+                return base + 1U;
+            }
+            for (uint8_t f = 5U; f < FIELDS_PER_MODE; f++) {
+                if (limits.*FIELDS[f] == 0U) {
+                    return base + f;
+                }
+            }
+        }
+        return FIELD_COUNT;
+    }
+
+    uint32_t crcOf(const Table& table) {
+        uint32_t crc = 0UL;
+        for (uint8_t m = 0U; m < PowerDistribution::MODE_COUNT; m++) {
+            for (uint8_t f = 0U; f < FIELDS_PER_MODE; f++) {
+                const uint16_t value = table.mode[m].*FIELDS[f];
+                const uint8_t bytes[2] = {
+                    static_cast<uint8_t>(value & 0xFFU),
+                    static_cast<uint8_t>(value >> 8)
+                };
+                crc = Crc::crc32(bytes, 2U, crc);
+            }
+        }
+        return crc;
+    }
+}
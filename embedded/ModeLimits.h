@@ -0,0 +1,137 @@
+/**
+ * @file ModeLimits.h
+ * @brief Limites par mode modifiables en vol (double tampon, échange atomique)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Les namespaces DecollageConfig / NormalConfig / UrgenceConfig de
+ * config.h restent les valeurs par défaut. La table active est lue par
+ * pointeur ; une nouvelle table est écrite dans le tampon inactif, validée
+ * (bornes, CRC-32) puis publiée par commit() en début de tick: un seul
+ * mot écrit, aucun verrou, la chaîne de contrôle ne voit jamais de table
+ * partielle.
+ *
+ * Les modules recopient les valeurs dont ils ont besoin à chaque échange
+ * (profils d'allocation, pentes, plafonds) : le tick ne lit que ces copies,
+ * au même coût qu'avec les constantes.
+ */
+
+#ifndef MODE_LIMITS_H
+#define MODE_LIMITS_H
+
+#include <stdint.h>
+#include "PowerDistribution.h"
+
+namespace ModeLimits {
+
+    /**
+     * @brief Limites d'un mode (mêmes champs que les namespaces de config.h)
+     */
+    struct Limits {
+        uint16_t minPower;          ///< Puissance minimale (Cv)
+        uint16_t maxPower;          ///< Puissance maximale (Cv)
+        uint16_t initialPower;      ///< Puissance initiale (Cv)
+        uint16_t electricMax;       ///< Plafond électrique (Cv), 0 = thermique seul
+        uint16_t thermalMax;        ///< Plafond thermique (Cv)
+        uint16_t electricRampUp;    ///< Montée électrique (Cv/s)
+        uint16_t electricRampDown;  ///< Descente électrique (Cv/s)
+        uint16_t thermalRampUp;     ///< Montée thermique (Cv/s)
+        uint16_t thermalRampDown;   ///< Descente thermique (Cv/s)
+    };
+
+    /**
+     * @brief Table complète (indexée par PowerDistribution::FlightMode)
+     */
+    struct Table {
+        Limits mode[PowerDistribution::MODE_COUNT];  ///< Limites par mode
+    };
+
+    /** @brief Champs par mode */
+    constexpr uint8_t FIELDS_PER_MODE = 9U;
+
+    /** @brief Champs d'une table (ordre: mode, puis champs de Limits) */
+    constexpr uint8_t FIELD_COUNT = FIELDS_PER_MODE * PowerDistribution::MODE_COUNT;
+
+    static_assert(sizeof(Limits) == FIELDS_PER_MODE * sizeof(uint16_t), "Limits: champs uint16_t seulement");
+
+    /** @brief Table par défaut (config.h) */
+    extern const Table DEFAULTS;
+
+    /** @brief Table publiée (définie dans ModeLimits.cpp) */
+    extern const Table* activeTable;
+
+    /**
+     * @brief Table active
+     */
+    inline const Table& active() {
+        return *__atomic_load_n(&activeTable, __ATOMIC_ACQUIRE);
+    }
+
+    /**
+     * @brief Limites actives d'un mode (mode inconnu: NORMAL, comme
+     *        PowerDistribution::getProfile)
+     */
+    inline const Limits& of(PowerDistribution::FlightMode mode) {
+        const uint8_t index = static_cast<uint8_t>(mode);
+        return active().mode[(index < PowerDistribution::MODE_COUNT)
+            ? index : static_cast<uint8_t>(PowerDistribution::FlightMode::NORMAL)];
+    }
+
+    /**
+     * @brief Ouvre le tampon inactif, initialisé avec la table active
+     *
+     * Annule un échange validé mais pas encore publié.
+     */
+    void beginEdit();
+
+    /**
+     * @brief Écrit un champ du tampon inactif
+     *
+     * @param index Rang (mode * FIELDS_PER_MODE + champ), < FIELD_COUNT
+     * @param value Valeur
+     * @return false si le rang est hors table ou si aucune édition n'est ouverte
+     */
+    bool setField(uint8_t index, uint16_t value);
+
+    /** @brief Retour de stage(): table validée */
+    constexpr uint8_t STAGED = 0xFFU;
+
+    /**
+     * @brief Valide le tampon inactif et programme l'échange
+     *
+     * @param crc CRC-32 attendu (crcOf() de la table)
+     * @return STAGED, sinon rang du champ rejeté (FIELD_COUNT = CRC faux) ;
+     *         l'édition est alors abandonnée
+     */
+    uint8_t stage(uint32_t crc);
+
+    /**
+     * @brief Publie la table validée (à appeler en frontière de tick)
+     *
+     * @return true si la table active a changé
+     */
+    bool commit();
+
+    /**
+     * @brief Vérifie la cohérence d'une table
+     *
+     * min ≤ initiale ≤ max ≤ électrique + thermique, électrique ≤
+     * BATTERY_MAX_POWER, max et thermique ≤ PLANT_MAX_POWER, pentes non
+     * nulles.
+     *
+     * @return Rang du premier champ faux, FIELD_COUNT si la table est valide
+     */
+    uint8_t validate(const Table& table);
+
+    /**
+     * @brief CRC-32 d'une table (champs en petit-boutiste, dans l'ordre)
+     */
+    uint32_t crcOf(const Table& table);
+
+    /**
+     * @brief Nombre d'échanges publiés depuis le démarrage
+     */
+    uint16_t getGeneration();
+}
+
+#endif // MODE_LIMITS_H
@@ -0,0 +1,113 @@
+/**
+ * @file PowerAllocator.cpp
+ * @brief Implémentation de l'allocateur générique de puissance
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "PowerAllocator.h"
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+PowerAllocator::PowerAllocator()
+    : stages_()
+    , count_(0U)
+    , minTotal_(0U)
+    , capacity_(0U)
+{
+}
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+bool PowerAllocator::configure(const Stage* stages, uint8_t count) {
+    if (count > POWER_ALLOCATOR_MAX_STAGES) {
+        return false;
+    }
+
+    uint32_t minTotal = 0U;
+    uint32_t capacity = 0U;
+    uint8_t seen = 0U;
+
+    for (uint8_t i = 0U; i < count; i++) {
+        // Source vérifiée avant le décalage (décalage ≥ 32 indéfini)
+        if (stages[i].source >= Source::COUNT) {
+            return false;
+        }
+
+        const uint8_t bit = static_cast<uint8_t>(1U << static_cast<uint8_t>(stages[i].source));
+
+        if (((seen & bit) != 0U) || (stages[i].min > stages[i].max)) {
+            return false;
+        }
+
+        seen |= bit;
+        minTotal += stages[i].min;
+        capacity += stages[i].max;
+    }
+
+    if (capacity > 0xFFFFU) {
+        return false;
+    }
+
+    for (uint8_t i = 0U; i < count; i++) {
+        stages_[i] = stages[i];
+    }
+    count_ = count;
+    minTotal_ = static_cast<uint16_t>(minTotal);
+    capacity_ = static_cast<uint16_t>(capacity);
+
+    return true;
+}
+
+// ============================================================================
+// ALLOCATION
+// ============================================================================
+
+PowerAllocator::Allocation PowerAllocator::allocate(uint16_t demand) const {
+    Allocation output = {};
+
+    // Demande au-delà des minimums (saturée à 0)
+    uint32_t remaining = static_cast<uint32_t>(demand) - minBranchless(demand, minTotal_);
+
+    for (uint8_t i = 0U; i < count_; i++) {
+        const Stage& stage = stages_[i];
+        const uint16_t extra = minBranchless(remaining, static_cast<uint32_t>(stage.max - stage.min));
+
+        output.power[static_cast<uint8_t>(stage.source)] = static_cast<uint16_t>(stage.min + extra);
+        output.total = static_cast<uint16_t>(output.total + stage.min + extra);
+        remaining -= extra;
+    }
+
+    return output;
+}
+
+// ============================================================================
+// ACCESSEURS
+// ============================================================================
+
+uint16_t PowerAllocator::getCapacity() const {
+    return capacity_;
+}
+
+uint16_t PowerAllocator::getMax(Source source) const {
+    for (uint8_t i = 0U; i < count_; i++) {
+        if (stages_[i].source == source) {
+            return stages_[i].max;
+        }
+    }
+    return 0U;
+}
+
+// ============================================================================
+// UTILITAIRES
+// ============================================================================
+
+uint16_t PowerAllocator::minBranchless(uint32_t a, uint32_t b) {
+    // mask = 0xFFFFFFFF si a < b, sinon 0
+    const uint32_t mask = 0U - static_cast<uint32_t>(a < b);
+    return static_cast<uint16_t>(b ^ ((a ^ b) & mask));
+}
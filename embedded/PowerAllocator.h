@@ -0,0 +1,117 @@
+/**
+ * @file PowerAllocator.h
+ * @brief Allocateur générique de puissance sur N sources par priorité
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Remplit les sources dans l'ordre de priorité jusqu'à leur plafond, le
+ * reste déborde sur la suivante. Chaque mode de vol n'est qu'un profil
+ * (liste ordonnée de sources avec minimum et plafond).
+ */
+
+#ifndef POWER_ALLOCATOR_H
+#define POWER_ALLOCATOR_H
+
+#include <stdint.h>
+
+/** @brief Nombre maximal d'étages dans un profil */
+#define POWER_ALLOCATOR_MAX_STAGES 4U
+
+/**
+ * @brief Allocateur à priorités
+ *
+ * Allocation en une passe, sans branchement dépendant des données, sans
+ * allocation dynamique ; l'objet ne contient que le profil (quelques
+ * dizaines d'octets) et allocate() est const, donc partageable entre
+ * plusieurs moteurs.
+ */
+class PowerAllocator {
+public:
+    /**
+     * @brief Sources de puissance connues
+     */
+    enum class Source : uint8_t {
+        ELECTRIC = 0U,       ///< Moteur électrique
+        THERMAL = 1U,        ///< Turbine thermique
+        APU = 2U,            ///< Groupe auxiliaire (futur)
+        BATTERY_BOOST = 3U,  ///< Boost batterie (futur)
+        COUNT = 4U
+    };
+
+    /** @brief Nombre de sources */
+    static constexpr uint8_t SOURCE_COUNT = static_cast<uint8_t>(Source::COUNT);
+
+    /**
+     * @brief Étage d'un profil (une source, rang = priorité)
+     */
+    struct Stage {
+        Source source;  ///< Source alimentée
+        uint16_t min;   ///< Puissance minimale toujours allouée (Cv)
+        uint16_t max;   ///< Plafond de la source (Cv)
+    };
+
+    /**
+     * @brief Résultat d'une allocation
+     */
+    struct Allocation {
+        uint16_t power[SOURCE_COUNT];  ///< Puissance par source (Cv), 0 si absente
+        uint16_t total;                ///< Somme des sources (Cv)
+    };
+
+    /**
+     * @brief Constructeur (profil vide: toute demande → 0)
+     */
+    PowerAllocator();
+
+    /**
+     * @brief Définit le profil
+     *
+     * Les étages sont donnés par priorité décroissante. Refusé (profil
+     * inchangé) si: trop d'étages, source dupliquée ou inconnue, min > max,
+     * capacité totale > 65535 Cv.
+     *
+     * @param stages Étages ordonnés
+     * @param count Nombre d'étages
+     * @return true si le profil est appliqué
+     */
+    bool configure(const Stage* stages, uint8_t count);
+
+    /**
+     * @brief Répartit une demande sur les sources
+     *
+     * Les minimums sont toujours servis (le total peut alors dépasser la
+     * demande), le reste remplit les étages dans l'ordre jusqu'au plafond.
+     *
+     * @param demand Puissance demandée (Cv)
+     * @return Allocation par source
+     */
+    Allocation allocate(uint16_t demand) const;
+
+    /**
+     * @brief Puissance maximale délivrable (somme des plafonds)
+     *
+     * @return Capacité (Cv)
+     */
+    uint16_t getCapacity() const;
+
+    /**
+     * @brief Plafond d'une source dans ce profil
+     *
+     * @param source Source
+     * @return Plafond (Cv), 0 si la source est absente du profil
+     */
+    uint16_t getMax(Source source) const;
+
+private:
+    Stage stages_[POWER_ALLOCATOR_MAX_STAGES];  ///< Étages par priorité
+    uint8_t count_;                             ///< Nombre d'étages
+    uint16_t minTotal_;                         ///< Somme des minimums
+    uint16_t capacity_;                         ///< Somme des plafonds
+
+    /**
+     * @brief min() sans branchement
+     */
+    static uint16_t minBranchless(uint32_t a, uint32_t b);
+};
+
+#endif // POWER_ALLOCATOR_H
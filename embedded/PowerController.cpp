@@ -0,0 +1,233 @@
+/**
+ * @file PowerController.cpp
+ * @brief Implémentation de la tâche de contrôle
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "PowerController.h"
+#include "config.h"
+#include "ModeLimits.h"
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+PowerController::PowerController(const PowerDistribution& distribution)
+    : distribution_(distribution)
+    , ramps_()
+    , blend_()
+    , spool_()
+    , electricLimit_(BATTERY_MAX_POWER)
+    , electricCommand_(0U)
+    , electricOverride_(ELECTRIC_AUTO)
+    , compensation_(SPOOL_COMPENSATION_DEFAULT != 0)
+{
+    blend_.setWindow(MODE_BLEND_TIME_MS, CONTROL_TICK_INTERVAL);
+    spool_.setTimeConstant(TURBINE_SPOOL_TAU_MS, CONTROL_TICK_INTERVAL);
+    reloadLimits();
+}
+
+void PowerController::reloadLimits() {
+    // Plafonds: relus à chaque tick dans les profils de PowerDistribution
+    applyRates(blend_.getMode());
+}
+
+// ============================================================================
+// CHAÎNE DE CONTRÔLE
+// ============================================================================
+
+void PowerController::reset(PowerDistribution::FlightMode mode, uint16_t totalPower) {
+    blend_.reset(mode);
+    applyRates(mode);
+
+    const PowerAllocator::Allocation allocation = distribution_.allocate(mode, totalPower);
+    for (uint8_t i = 0U; i < PowerAllocator::SOURCE_COUNT; i++) {
+        ramps_[i].reset(allocation.power[i]);
+    }
+
+    spool_.reset(allocation.power[static_cast<uint8_t>(PowerAllocator::Source::THERMAL)]);
+    electricCommand_ = allocation.power[static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)];
+}
+
+void PowerController::tick(PowerDistribution::FlightMode mode, uint16_t totalPower) {
+    // Changement de mode: fondu depuis la répartition courante
+    if (mode != blend_.getMode()) {
+        blend_.start(mode);
+        applyRates(mode);
+    }
+
+    updateTargets(totalPower);
+
+    for (uint8_t i = 0U; i < PowerAllocator::SOURCE_COUNT; i++) {
+        ramps_[i].tick();
+    }
+
+    updateCommand();
+    spool_.tick(getSetpoint(PowerAllocator::Source::THERMAL));
+
+    blend_.tick();
+}
+
+void PowerController::updateTargets(uint16_t totalPower) {
+    PowerAllocator::Allocation allocation = blend_.mix(distribution_, totalPower);
+
+    if (electricOverride_ != ELECTRIC_AUTO) {
+        applyOverride(allocation, totalPower);
+    }
+
+    for (uint8_t i = 0U; i < PowerAllocator::SOURCE_COUNT; i++) {
+        ramps_[i].setTarget(allocation.power[i]);
+    }
+}
+
+void PowerController::applyOverride(PowerAllocator::Allocation& allocation, uint16_t totalPower) const {
+    // Plafond électrique du mode (mélangé en fondu, 0 en NORMAL)
+    const uint16_t electricMax = blend_.mixMax(distribution_, PowerAllocator::Source::ELECTRIC);
+
+    uint16_t electric = (electricOverride_ < totalPower) ? electricOverride_ : totalPower;
+    electric = (electric < electricMax) ? electric : electricMax;
+    electric = (electric < electricLimit_) ? electric : electricLimit_;
+
+    // Le thermique complète, plafonné par le mode de destination
+    const uint16_t thermalMax = distribution_.getProfile(blend_.getMode()).getMax(PowerAllocator::Source::THERMAL);
+    const uint16_t rest = static_cast<uint16_t>(totalPower - electric);
+    const uint16_t thermal = (rest < thermalMax) ? rest : thermalMax;
+
+    allocation.power[static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)] = electric;
+    allocation.power[static_cast<uint8_t>(PowerAllocator::Source::THERMAL)] = thermal;
+    allocation.total = static_cast<uint16_t>(electric + thermal);
+}
+
+void PowerController::updateCommand() {
+    const uint16_t electric = getSetpoint(PowerAllocator::Source::ELECTRIC);
+
+    if (!compensation_) {
+        electricCommand_ = electric;
+        return;
+    }
+
+    // Écart thermique: > 0 en montée (turbine en retard), < 0 en descente
+    const int32_t deficit = static_cast<int32_t>(getSetpoint(PowerAllocator::Source::THERMAL))
+                          - static_cast<int32_t>(spool_.getDelivered());
+    int32_t command = static_cast<int32_t>(electric) + deficit;
+
+    // Plafond: mode actif (mélangé en fondu, 0 en NORMAL) et batterie, sans
+    // jamais couper une consigne déjà au-delà (sortie d'un mode électrique)
+    const uint16_t electricMax = blend_.mixMax(distribution_, PowerAllocator::Source::ELECTRIC);
+    uint16_t ceiling = (electricMax < electricLimit_) ? electricMax : electricLimit_;
+    ceiling = (electric > ceiling) ? electric : ceiling;
+
+    if (command > static_cast<int32_t>(ceiling)) {
+        command = ceiling;
+    }
+    if (command < 0) {
+        command = 0;
+    }
+
+    electricCommand_ = static_cast<uint16_t>(command);
+}
+
+// ============================================================================
+// ACCESSEURS
+// ============================================================================
+
+PowerDistribution::PowerOutput PowerController::getTarget() const {
+    PowerDistribution::PowerOutput output;
+
+    output.electric = ramps_[static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)].getTarget();
+    output.thermal = ramps_[static_cast<uint8_t>(PowerAllocator::Source::THERMAL)].getTarget();
+    output.total = output.electric + output.thermal;
+
+    return output;
+}
+
+PowerDistribution::PowerOutput PowerController::getSetpoint() const {
+    PowerDistribution::PowerOutput output;
+
+    output.electric = getSetpoint(PowerAllocator::Source::ELECTRIC);
+    output.thermal = getSetpoint(PowerAllocator::Source::THERMAL);
+    output.total = output.electric + output.thermal;
+
+    return output;
+}
+
+PowerDistribution::PowerOutput PowerController::getCommand() const {
+    PowerDistribution::PowerOutput output;
+
+    output.electric = electricCommand_;
+    output.thermal = getSetpoint(PowerAllocator::Source::THERMAL);
+    output.total = output.electric + output.thermal;
+
+    return output;
+}
+
+PowerDistribution::PowerOutput PowerController::getDelivered() const {
+    PowerDistribution::PowerOutput output;
+
+    output.electric = electricCommand_;
+    output.thermal = spool_.getDelivered();
+    output.total = output.electric + output.thermal;
+
+    return output;
+}
+
+uint16_t PowerController::getSetpoint(PowerAllocator::Source source) const {
+    return ramps_[static_cast<uint8_t>(source)].getCurrent();
+}
+
+uint16_t PowerController::getMax(PowerAllocator::Source source) const {
+    return blend_.mixMax(distribution_, source);
+}
+
+bool PowerController::isSettled() const {
+    for (uint8_t i = 0U; i < PowerAllocator::SOURCE_COUNT; i++) {
+        if (!ramps_[i].isSettled()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PowerController::isBlending() const {
+    return blend_.isBlending();
+}
+
+// ============================================================================
+// COMPENSATION DU RETARD TURBINE
+// ============================================================================
+
+void PowerController::setCompensation(bool enabled) {
+    compensation_ = enabled;
+}
+
+bool PowerController::isCompensating() const {
+    return compensation_;
+}
+
+void PowerController::setElectricLimit(uint16_t limit) {
+    electricLimit_ = limit;
+}
+
+// ============================================================================
+// PART ÉLECTRIQUE IMPOSÉE
+// ============================================================================
+
+void PowerController::setElectricOverride(uint16_t electric) {
+    electricOverride_ = electric;
+}
+
+// ============================================================================
+// PENTES PAR MODE
+// ============================================================================
+
+void PowerController::applyRates(PowerDistribution::FlightMode mode) {
+    SetpointRamp& electric = ramps_[static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)];
+    SetpointRamp& thermal = ramps_[static_cast<uint8_t>(PowerAllocator::Source::THERMAL)];
+    const ModeLimits::Limits& limits = ModeLimits::of(mode);
+
+    electric.setRates(limits.electricRampUp, limits.electricRampDown, CONTROL_TICK_INTERVAL);
+    thermal.setRates(limits.thermalRampUp, limits.thermalRampDown, CONTROL_TICK_INTERVAL);
+
+    // Sources futures (APU, boost): pas de limitation tant que non calibrées
+}
@@ -0,0 +1,187 @@
+/**
+ * @file PowerController.h
+ * @brief Tâche de contrôle à cadence fixe : cibles par source et rampes
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Chaîne par tick: (mode, puissance totale) → PowerDistribution (cibles
+ * par source) → ModeBlend (fondu lors d'un changement de mode) →
+ * SetpointRamp par source → compensation du retard turbine (TurbineSpool)
+ * → commandes envoyées aux moteurs.
+ */
+
+#ifndef POWER_CONTROLLER_H
+#define POWER_CONTROLLER_H
+
+#include <stdint.h>
+#include "PowerDistribution.h"
+#include "SetpointRamp.h"
+#include "ModeBlend.h"
+#include "TurbineSpool.h"
+
+/**
+ * @brief Contrôleur de consignes par source
+ *
+ * Expose séparément la cible (répartition instantanée du mode) et la
+ * consigne rampée. Coût O(1) par tick, entier uniquement.
+ */
+class PowerController {
+public:
+    /**
+     * @brief Constructeur
+     *
+     * @param distribution Calculateur de répartition (doit survivre au contrôleur)
+     */
+    explicit PowerController(const PowerDistribution& distribution);
+
+    /**
+     * @brief Force les consignes sur la répartition du mode (sans rampe)
+     *
+     * @param mode Mode de vol
+     * @param totalPower Puissance totale demandée (Cv)
+     */
+    void reset(PowerDistribution::FlightMode mode, uint16_t totalPower);
+
+    /**
+     * @brief Avance la chaîne de contrôle d'une période CONTROL_TICK_INTERVAL
+     *
+     * @param mode Mode de vol actif
+     * @param totalPower Puissance totale demandée (Cv)
+     */
+    void tick(PowerDistribution::FlightMode mode, uint16_t totalPower);
+
+    /**
+     * @brief Répartition cible (non rampée)
+     *
+     * @return Cibles electric/thermal/total
+     */
+    PowerDistribution::PowerOutput getTarget() const;
+
+    /**
+     * @brief Consignes courantes (rampées)
+     *
+     * @return Consignes electric/thermal/total
+     */
+    PowerDistribution::PowerOutput getSetpoint() const;
+
+    /**
+     * @brief Commandes moteurs (consignes + compensation du retard turbine)
+     *
+     * Hors compensation, identique à getSetpoint().
+     *
+     * @return Commandes electric/thermal/total
+     */
+    PowerDistribution::PowerOutput getCommand() const;
+
+    /**
+     * @brief Puissance délivrée estimée (électrique immédiat, thermique modélisé)
+     *
+     * @return Puissances electric/thermal/total
+     */
+    PowerDistribution::PowerOutput getDelivered() const;
+
+    /**
+     * @brief Consigne courante d'une source
+     *
+     * @param source Source
+     * @return Consigne rampée (Cv)
+     */
+    uint16_t getSetpoint(PowerAllocator::Source source) const;
+
+    /**
+     * @brief Plafond courant d'une source
+     *
+     * Plafond du mode actif, mélangé pendant un fondu (ModeBlend::mixMax).
+     *
+     * @param source Source
+     * @return Plafond (Cv)
+     */
+    uint16_t getMax(PowerAllocator::Source source) const;
+
+    /**
+     * @brief Toutes les consignes ont atteint leur cible
+     */
+    bool isSettled() const;
+
+    /**
+     * @brief Fondu de changement de mode en cours
+     */
+    bool isBlending() const;
+
+    /**
+     * @brief Active la compensation du retard turbine par l'électrique
+     *
+     * L'électrique couvre l'écart consigne/délivré thermique, dans la
+     * limite du plafond électrique du mode actif (mélangé pendant un
+     * fondu, 0 en NORMAL) et de la limite batterie.
+     *
+     * @param enabled true pour activer
+     */
+    void setCompensation(bool enabled);
+
+    /**
+     * @brief Compensation du retard turbine active
+     */
+    bool isCompensating() const;
+
+    /**
+     * @brief Limite la puissance électrique disponible (batterie)
+     *
+     * @param limit Puissance électrique maximale (Cv)
+     */
+    void setElectricLimit(uint16_t limit);
+
+    /**
+     * @brief Impose la part électrique (programme de vol)
+     *
+     * La cible électrique devient min(part, demande, plafond électrique du
+     * mode et batterie) et le thermique complète dans la limite du mode.
+     *
+     * @param electric Part électrique (Cv), ELECTRIC_AUTO = répartition du mode
+     */
+    void setElectricOverride(uint16_t electric);
+
+    /**
+     * @brief Relit les pentes après un échange de ModeLimits
+     *
+     * Appelé en frontière de tick, avec PowerDistribution::reloadLimits().
+     */
+    void reloadLimits();
+
+    /** @brief Pas de part électrique imposée */
+    static constexpr uint16_t ELECTRIC_AUTO = 0xFFFFU;
+
+private:
+    const PowerDistribution& distribution_;                ///< Répartition par mode
+    SetpointRamp ramps_[PowerAllocator::SOURCE_COUNT];     ///< Rampe par source
+    ModeBlend blend_;                                      ///< Fondu entre modes
+    TurbineSpool spool_;                                   ///< Réponse turbine estimée
+    uint16_t electricLimit_;                               ///< Limite batterie (Cv)
+    uint16_t electricCommand_;                             ///< Commande électrique compensée (Cv)
+    uint16_t electricOverride_;                            ///< Part électrique imposée (Cv)
+    bool compensation_;                                    ///< Compensation active
+
+    /**
+     * @brief Applique les pentes du mode (config.h) à chaque rampe
+     *
+     * @param mode Mode de vol
+     */
+    void applyRates(PowerDistribution::FlightMode mode);
+
+    /**
+     * @brief Met à jour les cibles depuis la répartition (mélangée) des modes
+     */
+    void updateTargets(uint16_t totalPower);
+
+    /**
+     * @brief Remplace la répartition par la part électrique imposée
+     */
+    void applyOverride(PowerAllocator::Allocation& allocation, uint16_t totalPower) const;
+
+    /**
+     * @brief Commande électrique couvrant l'écart thermique consigne/délivré
+     */
+    void updateCommand();
+};
+
+#endif // POWER_CONTROLLER_H
@@ -7,81 +7,93 @@
 
 #include "PowerDistribution.h"
 #include "config.h"
+#include "ModeLimits.h"
 
 // ============================================================================
 // CONSTRUCTEUR
 // ============================================================================
 
-PowerDistribution::PowerDistribution() {
-    // Pas d'initialisation nécessaire (classe sans état)
+PowerDistribution::PowerDistribution()
+    : electricLimit_(0xFFFFU)
+    , revision_(0U)
+{
+    configureProfiles();
 }
 
 // ============================================================================
-// CALCULS PAR MODE
+// LIMITE ÉLECTRIQUE
 // ============================================================================
 
-PowerDistribution::PowerOutput PowerDistribution::calculateDecollage(uint16_t totalPower) const {
-    PowerOutput output;
-    
-    // Mode DÉCOLLAGE: Électrique plafonné à 1000 Cv, thermique à 2250 Cv
-    output.electric = min(totalPower, DecollageConfig::ELECTRIC_MAX);
-    
-    // Calcul du reste pour le thermique
-    uint16_t remaining = 0U;
-    if (totalPower > output.electric) {
-        remaining = totalPower - output.electric;
+void PowerDistribution::setElectricLimit(uint16_t limit) {
+    if (limit == electricLimit_) {
+        return;
     }
-    
-    output.thermal = min(remaining, DecollageConfig::THERMAL_MAX);
-    output.total = output.electric + output.thermal;
-    
-    return output;
+
+    electricLimit_ = limit;
+    configureProfiles();
 }
 
-PowerDistribution::PowerOutput PowerDistribution::calculateNormal(uint16_t totalPower) const {
-    PowerOutput output;
-    
-    // Mode NORMAL: Thermique seul (pas d'électrique)
-    output.electric = 0U;
-    output.thermal = min(totalPower, NormalConfig::THERMAL_MAX);
-    output.total = output.thermal;
-    
-    return output;
+uint16_t PowerDistribution::getElectricLimit() const {
+    return electricLimit_;
 }
 
-PowerDistribution::PowerOutput PowerDistribution::calculateUrgence(uint16_t totalPower) const {
-    PowerOutput output;
-    
-    // Mode URGENCE: Électrique plafonné à 1000 Cv, thermique à 2750 Cv
-    output.electric = min(totalPower, UrgenceConfig::ELECTRIC_MAX);
-    
-    // Calcul du reste pour le thermique
-    uint16_t remaining = 0U;
-    if (totalPower > output.electric) {
-        remaining = totalPower - output.electric;
+void PowerDistribution::reloadLimits() {
+    configureProfiles();
+}
+
+uint16_t PowerDistribution::getRevision() const {
+    return revision_;
+}
+
+void PowerDistribution::configureProfiles() {
+    // Par défaut (config.h): DÉCOLLAGE et URGENCE électrique d'abord
+    // (1000 Cv) puis thermique (2250 / 2750 Cv), NORMAL thermique seul
+    for (uint8_t m = 0U; m < MODE_COUNT; m++) {
+        const ModeLimits::Limits& limits = ModeLimits::of(static_cast<FlightMode>(m));
+
+        // Plafond électrique borné par la limite dynamique (batterie)
+        const uint16_t electric = (limits.electricMax < electricLimit_) ? limits.electricMax : electricLimit_;
+
+        PowerAllocator::Stage stages[PowerAllocator::SOURCE_COUNT];
+        uint8_t count = 0U;
+        if (limits.electricMax > 0U) {
+            stages[count++] = { PowerAllocator::Source::ELECTRIC, 0U, electric };
+        }
+        stages[count++] = { PowerAllocator::Source::THERMAL, 0U, limits.thermalMax };
+
+        profiles_[m].configure(stages, count);
     }
-    
-    output.thermal = min(remaining, UrgenceConfig::THERMAL_MAX);
-    output.total = output.electric + output.thermal;
-    
-    return output;
+    revision_++;
 }
 
+// ============================================================================
+// CALCUL
+// ============================================================================
+
 PowerDistribution::PowerOutput PowerDistribution::calculate(FlightMode mode, uint16_t totalPower) const {
-    switch (mode) {
-        case FlightMode::DECOLLAGE:
-            return calculateDecollage(totalPower);
-        
-        case FlightMode::NORMAL:
-            return calculateNormal(totalPower);
-        
-        case FlightMode::URGENCE:
-            return calculateUrgence(totalPower);
-        
-        default:
-            // Mode par défaut (sécurité)
-            return calculateNormal(totalPower);
+    const PowerAllocator::Allocation allocation = allocate(mode, totalPower);
+    PowerOutput output;
+
+    output.electric = allocation.power[static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)];
+    output.thermal = allocation.power[static_cast<uint8_t>(PowerAllocator::Source::THERMAL)];
+    output.total = allocation.total;
+
+    return output;
+}
+
+PowerAllocator::Allocation PowerDistribution::allocate(FlightMode mode, uint16_t totalPower) const {
+    return getProfile(mode).allocate(totalPower);
+}
+
+const PowerAllocator& PowerDistribution::getProfile(FlightMode mode) const {
+    const uint8_t index = static_cast<uint8_t>(mode);
+
+    // Mode inconnu: profil NORMAL (sécurité)
+    if (index >= MODE_COUNT) {
+        return profiles_[static_cast<uint8_t>(FlightMode::NORMAL)];
     }
+
+    return profiles_[index];
 }
 
 // ============================================================================
@@ -97,11 +109,3 @@ uint16_t PowerDistribution::wattsToCv(float watts) {
     // Conversion inverse
     return static_cast<uint16_t>((watts * 100.0F) / POWER_CONVERSION_FACTOR);
 }
-
-// ============================================================================
-// UTILITAIRES
-// ============================================================================
-
-uint16_t PowerDistribution::min(uint16_t a, uint16_t b) {
-    return (a < b) ? a : b;
-}
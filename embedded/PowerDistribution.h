@@ -11,12 +11,14 @@
 #define POWER_DISTRIBUTION_H
 
 #include <stdint.h>
+#include "PowerAllocator.h"
 
 /**
  * @brief Classe de gestion de la distribution de puissance
  * 
  * Implémente la logique de répartition électrique/thermique
- * selon le mode de vol actif (Décollage, Normal, Urgence)
+ * selon le mode de vol actif (Décollage, Normal, Urgence). Chaque mode
+ * est un profil de PowerAllocator construit depuis config.h.
  */
 class PowerDistribution {
 public:
@@ -44,40 +46,37 @@ public:
     PowerDistribution();
 
     /**
-     * @brief Calcule la distribution de puissance pour le mode DÉCOLLAGE
+     * @brief Limite dynamique de la puissance électrique (batterie)
      * 
-     * Logique:
-     * - Électrique: min(totalPower, 1000 Cv)
-     * - Thermique: min(totalPower - electric, 2250 Cv)
+     * Abaisse le plafond électrique effectif de chaque mode ; la part non
+     * couverte bascule sur le thermique. Sans effet si la limite est
+     * inchangée.
      * 
-     * @param totalPower Puissance totale demandée (Cv)
-     * @return PowerOutput Structure avec electric/thermal/total
+     * @param limit Puissance électrique disponible (Cv, 0xFFFF = aucune)
      */
-    PowerOutput calculateDecollage(uint16_t totalPower) const;
+    void setElectricLimit(uint16_t limit);
 
     /**
-     * @brief Calcule la distribution de puissance pour le mode NORMAL
+     * @brief Limite électrique dynamique courante
      * 
-     * Logique:
-     * - Électrique: 0 Cv (thermique seul)
-     * - Thermique: min(totalPower, 2750 Cv)
-     * 
-     * @param totalPower Puissance totale demandée (Cv)
-     * @return PowerOutput Structure avec electric/thermal/total
+     * @return Limite (Cv)
      */
-    PowerOutput calculateNormal(uint16_t totalPower) const;
+    uint16_t getElectricLimit() const;
 
     /**
-     * @brief Calcule la distribution de puissance pour le mode URGENCE
+     * @brief Reconstruit les profils après un échange de ModeLimits
+     */
+    void reloadLimits();
+
+    /**
+     * @brief Révision des profils (avance à chaque reconstruction)
      * 
-     * Logique:
-     * - Électrique: min(totalPower, 1000 Cv)
-     * - Thermique: min(totalPower - electric, 2750 Cv)
+     * Permet aux résultats mémorisés (PowerState) de détecter une
+     * nouvelle limite électrique ou de nouvelles limites de mode.
      * 
-     * @param totalPower Puissance totale demandée (Cv)
-     * @return PowerOutput Structure avec electric/thermal/total
+     * @return Révision courante
      */
-    PowerOutput calculateUrgence(uint16_t totalPower) const;
+    uint16_t getRevision() const;
 
     /**
      * @brief Calcule la distribution selon le mode actif
@@ -88,9 +87,29 @@ public:
      */
     PowerOutput calculate(FlightMode mode, uint16_t totalPower) const;
 
+    /**
+     * @brief Répartition complète (toutes sources) selon le mode actif
+     * 
+     * @param mode Mode de vol
+     * @param totalPower Puissance totale demandée (Cv)
+     * @return Allocation par source
+     */
+    PowerAllocator::Allocation allocate(FlightMode mode, uint16_t totalPower) const;
+
+    /**
+     * @brief Profil d'allocation d'un mode
+     * 
+     * @param mode Mode de vol
+     * @return Allocateur configuré pour ce mode
+     */
+    const PowerAllocator& getProfile(FlightMode mode) const;
+
     /**
      * @brief Convertit une puissance en Cv vers Watts
      * 
+     * Version flottante de référence. Sur cible sans FPU, préférer
+     * PowerUnits::cvToWatts() (entier, même résultat).
+     * 
      * @param cv Puissance en chevaux
      * @return Puissance en Watts (float)
      */
@@ -99,20 +118,26 @@ public:
     /**
      * @brief Convertit une puissance en Watts vers Cv
      * 
+     * Version flottante de référence. Sur cible sans FPU, préférer
+     * PowerUnits::wattsToCv() (entier, troncature exacte).
+     * 
      * @param watts Puissance en Watts
      * @return Puissance en chevaux (uint16_t)
      */
     static uint16_t wattsToCv(float watts);
 
+    /** @brief Nombre de modes de vol */
+    static constexpr uint8_t MODE_COUNT = 3U;
+
 private:
+    PowerAllocator profiles_[MODE_COUNT];  ///< Profil par mode (indexé par FlightMode)
+    uint16_t electricLimit_;               ///< Limite électrique dynamique (Cv)
+    uint16_t revision_;                    ///< Reconstructions des profils
+
     /**
-     * @brief Fonction utilitaire min() type-safe
-     * 
-     * @param a Premier paramètre
-     * @param b Deuxième paramètre
-     * @return Minimum des deux paramètres
+     * @brief Construit les profils depuis config.h et la limite électrique
      */
-    static uint16_t min(uint16_t a, uint16_t b);
+    void configureProfiles();
 };
 
 #endif // POWER_DISTRIBUTION_H
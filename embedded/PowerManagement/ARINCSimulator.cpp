@@ -7,14 +7,18 @@
 
 #include "ARINCSimulator.h"
 #include "config.h"
+#include "Hal.h"
+#include "Metrics.h"
 #include <Arduino.h>
+#include <string.h>
 
 // ============================================================================
 // CONSTRUCTEUR
 // ============================================================================
 
-ARINCSimulator::ARINCSimulator() 
-    : messageCounter_(0U)
+ARINCSimulator::ARINCSimulator(SerialLink& port)
+    : port_(port)
+    , messageCounter_(0U)
 {
 }
 
@@ -23,36 +27,73 @@ ARINCSimulator::ARINCSimulator()
 // ============================================================================
 
 void ARINCSimulator::begin(uint32_t baudrate) {
-    Serial.begin(baudrate);
-    
-    // Attente stabilisation Serial
-    delay(1000);
+    // Pas d'attente: l'UART émet dès l'initialisation, la sortie reste
+    // mise en tampon par le pilote
+    port_.begin(baudrate);
     
     messageCounter_ = 0U;
 }
 
 void ARINCSimulator::sendSystemBanner() {
-    Serial.println(F(""));
-    Serial.println(F("╔════════════════════════════════════════════════════════════════╗"));
-    Serial.println(F("║    SAFRAN PW100 - SYSTÈME DE GESTION PUISSANCE HYBRIDE        ║"));
-    Serial.println(F("╠════════════════════════════════════════════════════════════════╣"));
-    Serial.print(F("║    Firmware: v"));
-    Serial.print(FIRMWARE_VERSION_MAJOR);
-    Serial.print(F("."));
-    Serial.print(FIRMWARE_VERSION_MINOR);
-    Serial.print(F("."));
-    Serial.print(FIRMWARE_VERSION_PATCH);
-    Serial.print(F(" - "));
-    Serial.print(FIRMWARE_BUILD);
-    Serial.println(F("                      ║"));
-    Serial.println(F("║    Protocole: ARINC 429 (Simulé)                               ║"));
-    Serial.print(F("║    Baudrate: "));
-    Serial.print(SERIAL_BAUDRATE);
-    Serial.println(F(" bps                                      ║"));
-    Serial.println(F("╚════════════════════════════════════════════════════════════════╝"));
-    Serial.println(F(""));
-    Serial.println(F("[SYSTEM] Initialisation complète - Prêt pour vol"));
-    Serial.println(F(""));
+    for (uint8_t line = 0U; sendSystemBannerLine(line); line++) {
+    }
+}
+
+bool ARINCSimulator::sendSystemBannerLine(uint8_t line) {
+    switch (line) {
+        case 0U:
+        case 8U:
+        case 10U:
+            port_.println(F(""));
+            break;
+        
+        case 1U:
+            port_.println(F("╔════════════════════════════════════════════════════════════════╗"));
+            break;
+        
+        case 2U:
+            port_.println(F("║    SAFRAN PW100 - SYSTÈME DE GESTION PUISSANCE HYBRIDE        ║"));
+            break;
+        
+        case 3U:
+            port_.println(F("╠════════════════════════════════════════════════════════════════╣"));
+            break;
+        
+        case 4U:
+            port_.print(F("║    Firmware: v"));
+            port_.print(FIRMWARE_VERSION_MAJOR);
+            port_.print(F("."));
+            port_.print(FIRMWARE_VERSION_MINOR);
+            port_.print(F("."));
+            port_.print(FIRMWARE_VERSION_PATCH);
+            port_.print(F(" - "));
+            port_.print(FIRMWARE_BUILD);
+            port_.println(F("                      ║"));
+            break;
+        
+        case 5U:
+            port_.println(F("║    Protocole: ARINC 429 (Simulé)                               ║"));
+            break;
+        
+        case 6U:
+            port_.print(F("║    Baudrate: "));
+            port_.print(SERIAL_BAUDRATE);
+            port_.println(F(" bps                                      ║"));
+            break;
+        
+        case 7U:
+            port_.println(F("╚════════════════════════════════════════════════════════════════╝"));
+            break;
+        
+        case 9U:
+            port_.println(F("[SYSTEM] Initialisation complète - Prêt pour vol"));
+            break;
+        
+        default:
+            return false;
+    }
+    
+    return true;
 }
 
 // ============================================================================
@@ -63,207 +104,532 @@ void ARINCSimulator::sendTotalPower(uint16_t power) {
     char labelStr[5];
     formatLabel(ARINC_LABEL_TOTAL_POWER, labelStr);
     
-    Serial.print(F("[ARINC] "));
-    Serial.print(labelStr);
-    Serial.print(F(" | TOTAL_POWER: "));
-    Serial.print(power);
-    Serial.print(F(" Cv | SEQ: "));
-    Serial.println(messageCounter_++);
+    port_.beginMessage(SerialLink::OutputClass::TELEMETRY, TELEMETRY_TOTAL);
+    port_.print(F("[ARINC] "));
+    port_.print(labelStr);
+    port_.print(F(" | TOTAL_POWER: "));
+    port_.print(power);
+    port_.print(F(" Cv | SEQ: "));
+    port_.println(messageCounter_++);
+    port_.endMessage();
 }
 
 void ARINCSimulator::sendElectricPower(uint16_t power) {
     char labelStr[5];
     formatLabel(ARINC_LABEL_ELECTRIC_POWER, labelStr);
     
-    Serial.print(F("[ARINC] "));
-    Serial.print(labelStr);
-    Serial.print(F(" | ELEC_POWER: "));
-    Serial.print(power);
-    Serial.print(F(" Cv | SEQ: "));
-    Serial.println(messageCounter_++);
+    port_.beginMessage(SerialLink::OutputClass::TELEMETRY, TELEMETRY_ELECTRIC);
+    port_.print(F("[ARINC] "));
+    port_.print(labelStr);
+    port_.print(F(" | ELEC_POWER: "));
+    port_.print(power);
+    port_.print(F(" Cv | SEQ: "));
+    port_.println(messageCounter_++);
+    port_.endMessage();
 }
 
 void ARINCSimulator::sendThermalPower(uint16_t power) {
     char labelStr[5];
     formatLabel(ARINC_LABEL_THERMAL_POWER, labelStr);
     
-    Serial.print(F("[ARINC] "));
-    Serial.print(labelStr);
-    Serial.print(F(" | THRM_POWER: "));
-    Serial.print(power);
-    Serial.print(F(" Cv | SEQ: "));
-    Serial.println(messageCounter_++);
+    port_.beginMessage(SerialLink::OutputClass::TELEMETRY, TELEMETRY_THERMAL);
+    port_.print(F("[ARINC] "));
+    port_.print(labelStr);
+    port_.print(F(" | THRM_POWER: "));
+    port_.print(power);
+    port_.print(F(" Cv | SEQ: "));
+    port_.println(messageCounter_++);
+    port_.endMessage();
+}
+
+void ARINCSimulator::sendBattery(uint16_t soc, uint16_t boostTime) {
+    char labelStr[5];
+    formatLabel(ARINC_LABEL_BATTERY, labelStr);
+    
+    port_.beginMessage(SerialLink::OutputClass::TELEMETRY, TELEMETRY_BATTERY);
+    port_.print(F("[ARINC] "));
+    port_.print(labelStr);
+    port_.print(F(" | BATT_SOC: "));
+    port_.print(soc / 10U);
+    port_.print('.');
+    port_.print(soc % 10U);
+    port_.print(F(" % | BOOST: "));
+    port_.print(boostTime);
+    port_.print(F(" s | SEQ: "));
+    port_.println(messageCounter_++);
+    port_.endMessage();
+}
+
+void ARINCSimulator::sendSystemStatus(uint32_t status) {
+    char labelStr[5];
+    char statusStr[9];
+    formatLabel(ARINC_LABEL_SYSTEM_STATUS, labelStr);
+    formatHex(status, 8U, statusStr);
+    statusStr[8] = '\0';
+    
+    port_.beginMessage(SerialLink::OutputClass::TELEMETRY, TELEMETRY_STATUS);
+    port_.print(F("[ARINC] "));
+    port_.print(labelStr);
+    port_.print(F(" | SYS_STATUS: "));
+    port_.print(statusStr);
+    port_.print(F(" | SEQ: "));
+    port_.println(messageCounter_++);
+    port_.endMessage();
 }
 
 void ARINCSimulator::sendFlightMode(PowerDistribution::FlightMode mode) {
     char labelStr[5];
     formatLabel(ARINC_LABEL_FLIGHT_MODE, labelStr);
     
-    Serial.print(F("[ARINC] "));
-    Serial.print(labelStr);
-    Serial.print(F(" | FLIGHT_MODE: "));
-    Serial.print(getModeName(mode));
-    Serial.print(F(" | SEQ: "));
-    Serial.println(messageCounter_++);
+    port_.beginMessage(SerialLink::OutputClass::SAFETY);
+    port_.print(F("[ARINC] "));
+    port_.print(labelStr);
+    port_.print(F(" | FLIGHT_MODE: "));
+    port_.print(getModeName(mode));
+    port_.print(F(" | SEQ: "));
+    port_.println(messageCounter_++);
+    port_.endMessage();
 }
 
-void ARINCSimulator::sendFullStatus(
-    PowerDistribution::FlightMode mode,
-    uint16_t totalPower,
-    uint16_t electricPower,
-    uint16_t thermalPower
-) {
-    Serial.println(F(""));
-    Serial.println(F("┌────────────────────────────────────────────────────────────┐"));
-    Serial.print(F("│ MODE: "));
-    Serial.print(getModeName(mode));
+void ARINCSimulator::sendFullStatus(const PowerState::Snapshot& state) {
+    port_.println(F(""));
+    port_.println(F("┌────────────────────────────────────────────────────────────┐"));
+    port_.print(F("│ MODE: "));
+    port_.print(getModeName(state.mode));
     
     // Padding pour alignement
-    const char* modeName = getModeName(mode);
+    const char* modeName = getModeName(state.mode);
     uint8_t modeLen = 0;
     while (modeName[modeLen] != '\0') modeLen++;
     
     for (uint8_t i = modeLen; i < 50; i++) {
-        Serial.print(F(" "));
-    }
-    Serial.println(F("│"));
-    
-    Serial.println(F("├────────────────────────────────────────────────────────────┤"));
-    Serial.print(F("│ Puissance Totale:      "));
-    Serial.print(totalPower);
-    Serial.print(F(" Cv"));
-    
-    // Padding
-    uint16_t digits = 0;
-    uint16_t temp = totalPower;
-    do {
-        digits++;
-        temp /= 10;
-    } while (temp > 0);
-    
-    for (uint8_t i = 0; i < (30 - digits); i++) {
-        Serial.print(F(" "));
-    }
-    Serial.println(F("│"));
-    
-    Serial.print(F("│ Puissance Électrique:  "));
-    Serial.print(electricPower);
-    Serial.print(F(" Cv"));
-    
-    // Padding
-    digits = 0;
-    temp = electricPower;
-    do {
-        digits++;
-        temp /= 10;
-    } while (temp > 0);
-    
-    for (uint8_t i = 0; i < (30 - digits); i++) {
-        Serial.print(F(" "));
-    }
-    Serial.println(F("│"));
-    
-    Serial.print(F("│ Puissance Thermique:   "));
-    Serial.print(thermalPower);
-    Serial.print(F(" Cv"));
-    
-    // Padding
-    digits = 0;
-    temp = thermalPower;
-    do {
-        digits++;
-        temp /= 10;
-    } while (temp > 0);
-    
-    for (uint8_t i = 0; i < (30 - digits); i++) {
-        Serial.print(F(" "));
+        port_.print(F(" "));
     }
-    Serial.println(F("│"));
-    
-    Serial.println(F("└────────────────────────────────────────────────────────────┘"));
-    Serial.println(F(""));
+    port_.println(F("│"));
+    
+    port_.println(F("├────────────────────────────────────────────────────────────┤"));
+    printPowerLine(F("│ Puissance Totale:      "), state.output.total, state.totalWatts);
+    printPowerLine(F("│ Puissance Électrique:  "), state.output.electric, state.electricWatts);
+    printPowerLine(F("│ Puissance Thermique:   "), state.output.thermal, state.thermalWatts);
+    port_.println(F("└────────────────────────────────────────────────────────────┘"));
+    port_.println(F(""));
 }
 
-void ARINCSimulator::sendDashboard(
-    PowerDistribution::FlightMode mode,
-    uint16_t totalPower,
-    uint16_t electricPower,
-    uint16_t thermalPower
-) {
-    Serial.println(F(""));
-    Serial.println(F("╔════════════════════════════════════════════════════════════════╗"));
-    Serial.print(F("║  MODE: "));
-    Serial.print(getModeName(mode));
+void ARINCSimulator::sendDashboard(const PowerState::Snapshot& state) {
+    port_.println(F(""));
+    port_.println(F("╔════════════════════════════════════════════════════════════════╗"));
+    port_.print(F("║  MODE: "));
+    port_.print(getModeName(state.mode));
     
     // Padding
-    const char* modeName = getModeName(mode);
+    const char* modeName = getModeName(state.mode);
     uint8_t modeLen = 0;
     while (modeName[modeLen] != '\0') modeLen++;
     
     for (uint8_t i = modeLen; i < 52; i++) {
-        Serial.print(F(" "));
+        port_.print(F(" "));
     }
-    Serial.println(F("║"));
-    
-    Serial.println(F("╠════════════════════════════════════════════════════════════════╣"));
-    
-    // Barre de puissance totale
-    Serial.print(F("║  TOTAL  ["));
+    port_.println(F("║"));
+    
+    port_.println(F("╠════════════════════════════════════════════════════════════════╣"));
+    
+    // Barres précalculées par PowerState (échelles 4000 / 1000 / 2750 Cv)
+    port_.print(F("║  TOTAL  ["));
+    printBar(state.totalBar);
+    port_.print(F("] "));
+    port_.print(state.output.total);
+    port_.println(F(" Cv ║"));
+    
+    port_.print(F("║  ELEC   ["));
+    printBar(state.electricBar);
+    port_.print(F("] "));
+    port_.print(state.output.electric);
+    port_.println(F(" Cv  ║"));
+    
+    port_.print(F("║  THRM   ["));
+    printBar(state.thermalBar);
+    port_.print(F("] "));
+    port_.print(state.output.thermal);
+    port_.println(F(" Cv ║"));
+    
+    port_.println(F("╚════════════════════════════════════════════════════════════════╝"));
+    port_.println(F(""));
+}
+
+void ARINCSimulator::printPowerLine(const __FlashStringHelper* label, uint16_t power, uint32_t watts) {
+    port_.print(label);
+    port_.print(power);
+    port_.print(F(" Cv ("));
+    port_.print(static_cast<unsigned long>(watts));
+    port_.print(F(" W)"));
+    
+    // Padding: 33 colonnes après le libellé (comme sans les watts)
+    uint8_t width = 8U;  // " Cv (" + " W)"
+    uint32_t temp = power;
+    do {
+        width++;
+        temp /= 10U;
+    } while (temp > 0U);
+    temp = watts;
+    do {
+        width++;
+        temp /= 10U;
+    } while (temp > 0U);
     
-    uint8_t barLength = (totalPower * 40U) / 4000U;  // Échelle sur 4000 Cv max
-    for (uint8_t i = 0; i < 40; i++) {
-        if (i < barLength) {
-            Serial.print(F("█"));
+    for (uint8_t i = width; i < 33U; i++) {
+        port_.print(F(" "));
+    }
+    port_.println(F("│"));
+}
+
+void ARINCSimulator::printBar(uint8_t length) {
+    for (uint8_t i = 0; i < PowerState::BAR_WIDTH; i++) {
+        if (i < length) {
+            port_.print(F("█"));
         } else {
-            Serial.print(F("░"));
+            port_.print(F("░"));
         }
     }
-    
-    Serial.print(F("] "));
-    Serial.print(totalPower);
-    Serial.println(F(" Cv ║"));
-    
-    // Barre de puissance électrique
-    Serial.print(F("║  ELEC   ["));
-    
-    barLength = (electricPower * 40U) / 1000U;  // Échelle sur 1000 Cv max
-    for (uint8_t i = 0; i < 40; i++) {
-        if (i < barLength) {
-            Serial.print(F("█"));
-        } else {
-            Serial.print(F("░"));
+}
+
+void ARINCSimulator::sendCalibration(const CalibrationCurve& curve, uint16_t demand) {
+    port_.print(F("[CAL] "));
+    port_.print((curve.getSource() == CalibrationCurve::Source::THERMAL) ? F("THRM") : F("ELEC"));
+    port_.print(F(" | "));
+    port_.print(curve.getCount());
+    port_.print(F(" pts | pas "));
+    port_.print(curve.getStep());
+    port_.print(curve.isDefault() ? F(" Cv | défaut | ") : F(" Cv | chargée | "));
+    port_.print(demand);
+    port_.print(F(" Cv = "));
+    port_.print(static_cast<unsigned long>(curve.toWatts(demand)));
+    port_.println(F(" W"));
+}
+
+// ============================================================================
+// JOURNALISATION DIFFÉRÉE
+// ============================================================================
+
+#if LOG_DEFERRED
+
+void ARINCSimulator::emitLog(LogId id, const uint32_t* args, uint8_t count) {
+    // Trame: SYNC | id | longueur | varint(SEQ) varint(args)... | checksum
+    uint8_t frame[3U + 5U * (1U + LOG_MAX_ARGS) + 1U];
+    uint8_t length = 0U;
+
+    if (count > LOG_MAX_ARGS) {
+        count = LOG_MAX_ARGS;
+    }
+
+    frame[0] = LOG_FRAME_SYNC;
+    frame[1] = static_cast<uint8_t>(id);
+
+    length += encodeVarint(messageCounter_++, &frame[3]);
+    for (uint8_t i = 0U; i < count; i++) {
+        length += encodeVarint(args[i], &frame[3U + length]);
+    }
+    frame[2] = length;
+
+    // Checksum sur id + longueur + charge utile
+    frame[3U + length] = calculateChecksum(&frame[1], 2U + length);
+
+    port_.beginMessage(SerialLink::OutputClass::SAFETY);
+    port_.write(frame, 4U + length);
+    port_.endMessage();
+}
+
+#else
+
+namespace {
+    /** @brief Table des formats (mode texte uniquement) */
+    const char* const LOG_FORMATS[] = {
+#define LOG_CATALOG_FORMAT(name, format) format,
+        LOG_CATALOG(LOG_CATALOG_FORMAT)
+#undef LOG_CATALOG_FORMAT
+    };
+}
+
+void ARINCSimulator::emitLog(LogId id, const uint32_t* args, uint8_t count) {
+    if (static_cast<uint8_t>(id) >= static_cast<uint8_t>(LogId::COUNT)) {
+        return;
+    }
+
+    const char* format = LOG_FORMATS[static_cast<uint8_t>(id)];
+    uint8_t argIndex = 0U;
+
+    messageCounter_++;
+    port_.beginMessage(SerialLink::OutputClass::SAFETY);
+
+    for (const char* p = format; *p != '\0'; p++) {
+        if ((*p != '%') || (p[1] == '\0')) {
+            port_.print(*p);
+            continue;
+        }
+
+        p++;
+        if (*p == '%') {
+            port_.print('%');
+            continue;
+        }
+
+        // Argument manquant: affiché 0 plutôt que lecture hors tableau
+        uint32_t value = (argIndex < count) ? args[argIndex] : 0U;
+        argIndex++;
+
+        switch (*p) {
+            case 'u':
+                port_.print(static_cast<unsigned long>(value));
+                break;
+
+            case 'x':
+                port_.print(static_cast<unsigned long>(value), HEX);
+                break;
+
+            case 'c':
+                port_.print(static_cast<char>(value));
+                break;
+
+            case 'M':
+                port_.print(getModeName(static_cast<PowerDistribution::FlightMode>(value)));
+                break;
+
+            default:
+                port_.print('?');
+                break;
         }
     }
-    
-    Serial.print(F("] "));
-    Serial.print(electricPower);
-    Serial.println(F(" Cv  ║"));
-    
-    // Barre de puissance thermique
-    Serial.print(F("║  THRM   ["));
-    
-    barLength = (thermalPower * 40U) / 2750U;  // Échelle sur 2750 Cv max
-    for (uint8_t i = 0; i < 40; i++) {
-        if (i < barLength) {
-            Serial.print(F("█"));
+
+    port_.println();
+    port_.endMessage();
+}
+
+#endif // LOG_DEFERRED
+
+uint8_t ARINCSimulator::encodeVarint(uint32_t value, uint8_t* buffer) {
+    uint8_t length = 0U;
+
+    while (value >= 0x80U) {
+        buffer[length++] = static_cast<uint8_t>(value | 0x80U);
+        value >>= 7;
+    }
+    buffer[length++] = static_cast<uint8_t>(value);
+
+    return length;
+}
+
+void ARINCSimulator::sendTrace(const TraceBuffer& trace) {
+    // Fenêtre relevée une fois: les événements tracés pendant le vidage ne la décalent pas
+    const uint32_t head = trace.getEventCount();
+    const uint16_t size = (head < TRACE_BUFFER_SIZE) ? static_cast<uint16_t>(head) : TRACE_BUFFER_SIZE;
+    const uint32_t first = head - size;
+
+    // Vidage demandé: complet, au rythme de la ligne plutôt que perdu
+    port_.waitForUi(32U);
+    port_.print(F("[TRACE] BEGIN "));
+    port_.print(size);
+    port_.print(F("/"));
+    port_.println(head);
+
+    // "TTTTTTTT E AAA BBB"
+    char line[19];
+    line[8] = ' ';
+    line[10] = ' ';
+    line[14] = ' ';
+    line[18] = '\0';
+
+    for (uint16_t i = 0U; i < size; i++) {
+        TraceBuffer::Entry entry;
+
+        if (trace.getEntry(first, i, &entry)) {
+            formatHex(entry.timestamp, 8U, &line[0]);
+            formatHex(static_cast<uint32_t>(TraceBuffer::eventOf(entry.data)), 1U, &line[9]);
+            formatHex(TraceBuffer::fieldA(entry.data), 3U, &line[11]);
+            formatHex(TraceBuffer::fieldB(entry.data), 3U, &line[15]);
         } else {
-            Serial.print(F("░"));
+            // Entrée réécrite pendant le vidage (ou en cours d'écriture): une ligne par rang
+            memset(line, '-', sizeof(line) - 1U);
+            line[8] = ' ';
+            line[10] = ' ';
+            line[14] = ' ';
+        }
+        port_.waitForUi(sizeof(line) + 1U);
+        port_.println(line);
+
+        if ((i % TRACE_DUMP_KICK_INTERVAL) == 0U) {
+            Hal::watchdogKick();
         }
     }
-    
-    Serial.print(F("] "));
-    Serial.print(thermalPower);
-    Serial.println(F(" Cv ║"));
-    
-    Serial.println(F("╚════════════════════════════════════════════════════════════════╝"));
-    Serial.println(F(""));
+
+    port_.waitForUi(16U);
+    port_.println(F("[TRACE] END"));
 }
 
-void ARINCSimulator::sendError(const char* errorMsg) {
-    Serial.print(F("[ERROR] "));
-    Serial.print(errorMsg);
-    Serial.print(F(" | SEQ: "));
-    Serial.println(messageCounter_++);
+// ============================================================================
+// MÉTRIQUES
+// ============================================================================
+
+void ARINCSimulator::sendMetrics() {
+    for (uint8_t i = 0U; i < Metrics::COUNT; i++) {
+        const Metrics::Id id = static_cast<Metrics::Id>(i);
+        
+        port_.print(F("[METRICS] "));
+        port_.print(Metrics::labelOf(id));
+        port_.print(F(": "));
+        port_.println(static_cast<unsigned long>(Metrics::get(id)));
+    }
+}
+
+void ARINCSimulator::sendTopics() {
+    for (uint8_t i = 0U; i < TopicBus::COUNT; i++) {
+        const TopicBus::Topic topic = static_cast<TopicBus::Topic>(i);
+        const TopicBus::Counters& counters = TopicBus::counters[i];
+        
+        port_.print(F("[BUS] "));
+        port_.print(TopicBus::nameOf(topic));
+        port_.print(F(" ("));
+        port_.print(TopicBus::labelOf(topic));
+        port_.print(F(") | publications "));
+        port_.print(static_cast<unsigned long>(counters.version));
+        port_.print(F(" | abonnés "));
+        port_.print(counters.subscribers);
+        port_.print(F(" | livraisons "));
+        port_.print(static_cast<unsigned long>(counters.deliveries));
+        port_.print(F(" | sautées "));
+        port_.println(static_cast<unsigned long>(counters.skipped));
+    }
+}
+
+void ARINCSimulator::sendOutputClasses() {
+    static const char* const NAMES[SerialLink::CLASS_COUNT] = { "SAFETY", "TELEMETRY", "UI" };
+
+    for (uint8_t i = 0U; i < SerialLink::CLASS_COUNT; i++) {
+        const SerialLink::ClassCounters& counters = port_.getCounters(static_cast<SerialLink::OutputClass>(i));
+
+        port_.print(F("[TX] "));
+        port_.print(NAMES[i]);
+        port_.print(F(" | messages "));
+        port_.print(static_cast<unsigned long>(counters.messages));
+        port_.print(F(" | octets "));
+        port_.print(static_cast<unsigned long>(counters.bytes));
+        port_.print(F(" | remplacés "));
+        port_.print(static_cast<unsigned long>(counters.replaced));
+        port_.print(F(" | perdus "));
+        port_.print(static_cast<unsigned long>(counters.dropped));
+        port_.print(F(" | attentes "));
+        port_.print(static_cast<unsigned long>(counters.waits));
+        port_.print(F(" | file max "));
+        port_.println(counters.peak);
+    }
+}
+
+void ARINCSimulator::sendLinkRate(const LinkRate& rate) {
+    port_.print(F("[LINK] "));
+    port_.print(static_cast<unsigned long>(rate.getBaudrate()));
+    port_.print(F(" bps | confirmée "));
+    port_.print(static_cast<unsigned long>(rate.getConfirmed()));
+    switch (rate.getState()) {
+        case LinkRate::State::CONFIRMING:
+            port_.print(F(" | ping attendu"));
+            break;
+        case LinkRate::State::VERIFYING:
+            port_.print(F(" | PONG émis, confirmation attendue"));
+            break;
+        case LinkRate::State::STABLE:
+        default:
+            port_.print(F(" | stable"));
+            break;
+    }
+    port_.print(F(" | confirmations "));
+    port_.print(rate.getSwitches());
+    port_.print(F(" | replis "));
+    port_.println(rate.getFallbacks());
+}
+
+// ============================================================================
+// STATISTIQUES D'UTILISATION
+// ============================================================================
+
+void ARINCSimulator::sendUsage(const UsageStats& stats, uint16_t tickMs) {
+    port_.print(F("[USAGE] bandes "));
+    port_.print(1U << USAGE_BAND_SHIFT);
+    port_.println(F(" Cv, temps en s"));
+
+    for (uint8_t m = 0U; m < PowerDistribution::MODE_COUNT; m++) {
+        const PowerDistribution::FlightMode mode = static_cast<PowerDistribution::FlightMode>(m);
+        const UsageStats::Mode& usage = stats.getMode(mode);
+
+        port_.print(F("[USAGE] "));
+        port_.print(getModeName(mode));
+        port_.print(F(" | "));
+        port_.print(static_cast<unsigned long>((static_cast<uint64_t>(usage.ticks) * tickMs) / 1000U));
+        port_.print(F(" s | écrêt. "));
+        port_.print(static_cast<unsigned long>(usage.capped));
+        port_.print(F(" | déficit "));
+        port_.print(static_cast<unsigned long>((static_cast<uint64_t>(usage.shortfall) * tickMs) / 1000U));
+        port_.println(F(" s"));
+
+        if (usage.ticks == 0U) {
+            continue;
+        }
+
+        for (uint8_t e = 0U; e < UsageStats::ENGINE_COUNT; e++) {
+            const UsageStats::Engine& engine = usage.engine[e];
+
+            port_.print((e == static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)) ? F("  ELEC ") : F("  THRM "));
+            port_.print(engine.min);
+            port_.print('/');
+            port_.print(static_cast<unsigned long>(engine.sum / usage.ticks));
+            port_.print('/');
+            port_.print(engine.max);
+            port_.print(F(" |"));
+            for (uint8_t b = 0U; b < UsageStats::BAND_COUNT; b++) {
+                port_.print(' ');
+                port_.print(static_cast<unsigned long>((static_cast<uint64_t>(engine.bands[b]) * tickMs) / 1000U));
+            }
+            port_.println(F(""));
+        }
+    }
+}
+
+// ============================================================================
+// LIMITES PAR MODE
+// ============================================================================
+
+void ARINCSimulator::sendLimits(const ModeLimits::Table& table, uint16_t generation) {
+    for (uint8_t m = 0U; m < PowerDistribution::MODE_COUNT; m++) {
+        const PowerDistribution::FlightMode mode = static_cast<PowerDistribution::FlightMode>(m);
+        const ModeLimits::Limits& limits = table.mode[m];
+
+        port_.print(F("[LIM] "));
+        port_.print(getModeName(mode));
+        port_.print(F(" | "));
+        port_.print(limits.minPower);
+        port_.print(F(".."));
+        port_.print(limits.maxPower);
+        port_.print(F(" Cv | init "));
+        port_.print(limits.initialPower);
+        port_.print(F(" | élec "));
+        port_.print(limits.electricMax);
+        port_.print(F(" | therm "));
+        port_.print(limits.thermalMax);
+        port_.print(F(" | pentes "));
+        port_.print(limits.electricRampUp);
+        port_.print('/');
+        port_.print(limits.electricRampDown);
+        port_.print(' ');
+        port_.print(limits.thermalRampUp);
+        port_.print('/');
+        port_.print(limits.thermalRampDown);
+        port_.println(F(" Cv/s"));
+    }
+
+    char crc[9];
+    formatHex(ModeLimits::crcOf(table), 8U, crc);
+    crc[8] = '\0';
+    port_.print(F("[LIM] génération "));
+    port_.print(generation);
+    port_.print(F(" | CRC "));
+    port_.println(crc);
 }
 
 // ============================================================================
@@ -278,6 +644,15 @@ void ARINCSimulator::formatLabel(uint16_t label, char* buffer) const {
     buffer[3] = '\0';
 }
 
+void ARINCSimulator::formatHex(uint32_t value, uint8_t digits, char* buffer) const {
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+    for (uint8_t i = digits; i > 0U; i--) {
+        buffer[i - 1U] = HEX_DIGITS[value & 0x0FU];
+        value >>= 4;
+    }
+}
+
 uint8_t ARINCSimulator::calculateChecksum(const uint8_t* data, size_t length) const {
     uint8_t checksum = 0U;
     
@@ -0,0 +1,164 @@
+/**
+ * @file Calibration.h
+ * @brief Courbes de calibration non linéaires demande (Cv) → puissance (W)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Une courbe par source (moteur électrique, turbine). Les points sont
+ * échantillonnés sur une grille uniforme de pas 2^shift Cv : le segment est
+ * trouvé par décalage (pas de recherche), l'interpolation linéaire est
+ * entière. Coût constant quel que soit le nombre de points.
+ */
+
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include <stdint.h>
+#include "config.h"
+
+/**
+ * @brief Courbe de calibration à grille uniforme
+ *
+ * Courbe par défaut en flash ; une courbe chargée par liaison série est
+ * copiée en RAM. Les points reçus remplissent une table de préparation
+ * (commune aux deux sources, un chargement à la fois) : la courbe active
+ * n'est remplacée qu'à commitLoad(). Un chargement rejeté, interrompu ou
+ * incomplet la laisse intacte.
+ */
+class CalibrationCurve {
+public:
+    /**
+     * @brief Source de puissance calibrée
+     */
+    enum class Source : uint8_t {
+        ELECTRIC = 0U,  ///< Moteur électrique
+        THERMAL = 1U,   ///< Turbine thermique
+        COUNT = 2U
+    };
+
+    /**
+     * @brief Constructeur (courbe par défaut de la source)
+     *
+     * @param source Source de puissance
+     */
+    explicit CalibrationCurve(Source source);
+
+    /**
+     * @brief Revient à la courbe par défaut (flash)
+     */
+    void reset();
+
+    /**
+     * @brief Démarre le chargement d'une nouvelle courbe
+     *
+     * Abandonne tout chargement en cours (des deux sources) ; la courbe
+     * active n'est pas modifiée.
+     *
+     * @param shift log2 du pas de grille (Cv), max CALIBRATION_MAX_SHIFT
+     * @param count Nombre de points (2..CALIBRATION_MAX_POINTS)
+     * @return false si paramètres invalides
+     */
+    bool beginLoad(uint8_t shift, uint16_t count);
+
+    /**
+     * @brief Ajoute le point suivant (W à la demande index × pas)
+     *
+     * Les points doivent être croissants (au sens large) et l'écart entre
+     * deux points tenir dans l'interpolation 32 bits.
+     *
+     * @param watts Puissance fournie (W)
+     * @return false si point invalide (chargement abandonné)
+     */
+    bool appendPoint(uint32_t watts);
+
+    /**
+     * @brief Active la courbe chargée si tous les points ont été reçus
+     *
+     * @return true si la nouvelle courbe est active (sinon l'ancienne reste)
+     */
+    bool commitLoad();
+
+    /**
+     * @brief Puissance fournie pour une demande (interpolation linéaire)
+     *
+     * Arrondi au plus proche (demi vers +∞). Au-delà du dernier point la
+     * courbe est prolongée à plat.
+     *
+     * @param cv Demande (Cv)
+     * @return Puissance (W)
+     */
+    uint32_t toWatts(uint16_t cv) const;
+
+    /**
+     * @brief Source de la courbe
+     */
+    Source getSource() const;
+
+    /**
+     * @brief Nombre de points de la courbe active
+     */
+    uint16_t getCount() const;
+
+    /**
+     * @brief Pas de grille de la courbe active (Cv)
+     */
+    uint16_t getStep() const;
+
+    /**
+     * @brief log2 du pas de grille de la courbe active
+     */
+    uint8_t getShift() const;
+
+    /**
+     * @brief Point de la courbe active
+     *
+     * @param index Rang (< getCount())
+     * @return Puissance au point (W)
+     */
+    uint32_t getPoint(uint16_t index) const;
+
+    /**
+     * @brief Courbe active = courbe par défaut flash
+     */
+    bool isDefault() const;
+
+    /**
+     * @brief Révision de la courbe active (avance à chaque activation)
+     *
+     * Permet aux résultats mémorisés (PowerState) de détecter une
+     * nouvelle courbe.
+     */
+    uint16_t getRevision() const;
+
+private:
+    Source source_;                              ///< Source calibrée
+    const uint32_t* points_;                     ///< Table active (flash ou RAM)
+    uint16_t count_;                             ///< Points de la table active
+    uint8_t shift_;                              ///< log2(pas) de la table active
+    uint16_t revision_;                          ///< Activations de courbe
+
+    uint32_t ram_[CALIBRATION_MAX_POINTS];       ///< Table chargée par série
+    uint16_t loadCount_;                         ///< Points attendus (chargement)
+    uint16_t loadIndex_;                         ///< Points reçus (chargement)
+    uint8_t loadShift_;                          ///< log2(pas) en chargement
+};
+
+// ============================================================================
+// CHEMIN CRITIQUE (inline)
+// ============================================================================
+
+inline uint32_t CalibrationCurve::toWatts(uint16_t cv) const {
+    const uint16_t index = static_cast<uint16_t>(cv >> shift_);
+
+    if (index >= (count_ - 1U)) {
+        return points_[count_ - 1U];
+    }
+
+    const int32_t frac = static_cast<int32_t>(cv & ((1U << shift_) - 1U));
+    const int32_t delta = static_cast<int32_t>(points_[index + 1U] - points_[index]);
+    const int32_t half = static_cast<int32_t>((1U << shift_) >> 1);
+
+    return points_[index] + static_cast<uint32_t>((delta * frac + half) >> shift_);
+}
+
+#endif // CALIBRATION_H
@@ -0,0 +1,33 @@
+/**
+ * @file Crc.h
+ * @brief CRC-32 (IEEE 802.3) pour les enregistrements persistés et téléchargés
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Table de 16 mots (64 octets de flash), un demi-octet par itération :
+ * compromis taille/vitesse adapté aux quelques centaines d'octets
+ * vérifiés au démarrage.
+ */
+
+#ifndef CRC_H
+#define CRC_H
+
+#include <stdint.h>
+
+namespace Crc {
+
+    /**
+     * @brief CRC-32 d'un bloc, chaînable
+     *
+     * crc32(b, crc32(a)) == crc32(a + b): un enregistrement peut être
+     * vérifié par morceaux sans tampon intermédiaire.
+     *
+     * @param data Données
+     * @param size Taille (octets)
+     * @param crc CRC du bloc précédent (0 pour commencer)
+     * @return CRC-32 (même valeur que zlib)
+     */
+    uint32_t crc32(const void* data, uint16_t size, uint32_t crc = 0UL);
+}
+
+#endif // CRC_H
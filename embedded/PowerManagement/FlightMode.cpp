@@ -7,6 +7,7 @@
 
 #include "FlightMode.h"
 #include "config.h"
+#include "ModeLimits.h"
 
 // ============================================================================
 // CONSTRUCTEUR
@@ -117,35 +118,11 @@ uint16_t FlightMode::getTotalPower() const {
 // ============================================================================
 
 uint16_t FlightMode::getMinPower() const {
-    switch (currentMode_) {
-        case PowerDistribution::FlightMode::DECOLLAGE:
-            return DecollageConfig::MIN_POWER;
-        
-        case PowerDistribution::FlightMode::NORMAL:
-            return NormalConfig::MIN_POWER;
-        
-        case PowerDistribution::FlightMode::URGENCE:
-            return UrgenceConfig::MIN_POWER;
-        
-        default:
-            return 0U;
-    }
+    return ModeLimits::of(currentMode_).minPower;
 }
 
 uint16_t FlightMode::getMaxPower() const {
-    switch (currentMode_) {
-        case PowerDistribution::FlightMode::DECOLLAGE:
-            return DecollageConfig::MAX_POWER;
-        
-        case PowerDistribution::FlightMode::NORMAL:
-            return NormalConfig::MAX_POWER;
-        
-        case PowerDistribution::FlightMode::URGENCE:
-            return UrgenceConfig::MAX_POWER;
-        
-        default:
-            return 0U;
-    }
+    return ModeLimits::of(currentMode_).maxPower;
 }
 
 // ============================================================================
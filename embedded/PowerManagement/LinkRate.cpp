@@ -0,0 +1,131 @@
+/**
+ * @file LinkRate.cpp
+ * @brief Implémentation de la négociation de vitesse série
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "LinkRate.h"
+#include "config.h"
+#include "Crc.h"
+
+namespace {
+    /** @brief Vitesses acceptées (bps) */
+    const uint32_t RATES[] = { SERIAL_BAUDRATE, 460800UL, 921600UL, 2000000UL };
+
+    /**
+     * @brief CRC-32 de {a, b} en petit-boutiste (indépendant de la cible)
+     */
+    uint32_t crcOfPair(uint32_t a, uint32_t b) {
+        uint8_t bytes[8];
+        for (uint8_t i = 0U; i < 4U; i++) {
+            bytes[i] = static_cast<uint8_t>(a >> (8U * i));
+            bytes[4U + i] = static_cast<uint8_t>(b >> (8U * i));
+        }
+        return Crc::crc32(bytes, sizeof(bytes));
+    }
+}
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+LinkRate::LinkRate()
+    : confirmed_(SERIAL_BAUDRATE)
+    , active_(SERIAL_BAUDRATE)
+    , deadline_(0U)
+    , state_(State::STABLE)
+    , switches_(0U)
+    , fallbacks_(0U)
+{
+}
+
+// ============================================================================
+// PROTOCOLE
+// ============================================================================
+
+bool LinkRate::isSupported(uint32_t baudrate) {
+    for (uint8_t i = 0U; i < sizeof(RATES) / sizeof(RATES[0]); i++) {
+        if (RATES[i] == baudrate) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t LinkRate::pingCrc(uint32_t nonce, uint32_t baudrate) {
+    return crcOfPair(nonce, baudrate);
+}
+
+uint32_t LinkRate::pongCrc(uint32_t nonce, uint32_t baudrate) {
+    return crcOfPair(~nonce, baudrate);
+}
+
+bool LinkRate::propose(uint32_t baudrate, uint32_t nowMs) {
+    if (state_ != State::STABLE || !isSupported(baudrate)) {
+        return false;
+    }
+
+    active_ = baudrate;
+    deadline_ = nowMs + LINK_CONFIRM_TIMEOUT_MS;
+    state_ = State::CONFIRMING;
+    return true;
+}
+
+bool LinkRate::confirm(uint32_t nonce, uint32_t crc, uint32_t nowMs) {
+    if (crc != pingCrc(nonce, active_)) {
+        return false;
+    }
+
+    if (state_ == State::CONFIRMING) {
+        // PONG à suivre: la vitesse n'est retenue qu'une fois reçue par le PC
+        deadline_ = nowMs + LINK_CONFIRM_TIMEOUT_MS;
+        state_ = State::VERIFYING;
+    } else if (state_ == State::VERIFYING) {
+        confirmed_ = active_;
+        state_ = State::STABLE;
+        switches_++;
+    }
+    return true;
+}
+
+bool LinkRate::isNegotiating() const {
+    return state_ != State::STABLE;
+}
+
+bool LinkRate::isExpired(uint32_t nowMs) const {
+    return isNegotiating() && (static_cast<int32_t>(nowMs - deadline_) >= 0);
+}
+
+uint32_t LinkRate::fallBack() {
+    if (isNegotiating()) {
+        active_ = confirmed_;
+        state_ = State::STABLE;
+        fallbacks_++;
+    }
+    return active_;
+}
+
+// ============================================================================
+// ACCESSEURS
+// ============================================================================
+
+LinkRate::State LinkRate::getState() const {
+    return state_;
+}
+
+uint32_t LinkRate::getBaudrate() const {
+    return active_;
+}
+
+uint32_t LinkRate::getConfirmed() const {
+    return confirmed_;
+}
+
+uint16_t LinkRate::getSwitches() const {
+    return switches_;
+}
+
+uint16_t LinkRate::getFallbacks() const {
+    return fallbacks_;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file LinkRate.h
+ * @brief Négociation de la vitesse série avec confirmation par ping CRC
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Séquence ('b', côté PC: tools/link_negotiate.py):
+ * 1. PC → "b <vitesse>" ; le firmware acquitte à la vitesse courante puis
+ *    bascule (propose())
+ * 2. PC bascule et envoie "b <nonce> <crc>", crc = CRC-32 de
+ *    {nonce, vitesse} (2 mots petit-boutistes) ; le firmware répond avec
+ *    le CRC-32 de {~nonce, vitesse} (PONG, confirm())
+ * 3. PC vérifie le PONG puis renvoie un ping (nouveau nonce) à la
+ *    nouvelle vitesse ; le firmware ne retient la vitesse qu'à ce ping
+ *    ("[LINK] OK") : un PONG corrompu laisse le PC à l'ancienne vitesse,
+ *    le firmware n'en recevant rien y revient aussi
+ * 4. Pas de ping valide sous LINK_CONFIRM_TIMEOUT_MS (délai réarmé au
+ *    PONG), ou ping faux avant le PONG: retour à la dernière vitesse
+ *    confirmée (fallBack()), des deux côtés
+ *
+ * Logique pure (pas d'accès au port): le sketch pilote SerialLink.
+ */
+
+#ifndef LINK_RATE_H
+#define LINK_RATE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Vitesse série négociée
+ */
+class LinkRate {
+public:
+    /**
+     * @brief État de la négociation
+     */
+    enum class State : uint8_t {
+        STABLE = 0,      ///< Vitesse confirmée
+        CONFIRMING = 1,  ///< Nouvelle vitesse active, ping attendu
+        VERIFYING = 2    ///< PONG émis, second ping du PC attendu
+    };
+
+    /**
+     * @brief Constructeur (SERIAL_BAUDRATE confirmée)
+     */
+    LinkRate();
+
+    /**
+     * @brief Vitesse proposable ?
+     *
+     * @param baudrate Vitesse (bps)
+     * @return true pour SERIAL_BAUDRATE, 460800, 921600 et 2000000
+     */
+    static bool isSupported(uint32_t baudrate);
+
+    /**
+     * @brief CRC attendu dans le ping du PC
+     */
+    static uint32_t pingCrc(uint32_t nonce, uint32_t baudrate);
+
+    /**
+     * @brief CRC de la réponse du firmware
+     */
+    static uint32_t pongCrc(uint32_t nonce, uint32_t baudrate);
+
+    /**
+     * @brief Accepte une proposition de vitesse
+     *
+     * @param baudrate Vitesse proposée (bps)
+     * @param nowMs Heure courante (ms)
+     * @return false si non supportée ou confirmation déjà en cours
+     */
+    bool propose(uint32_t baudrate, uint32_t nowMs);
+
+    /**
+     * @brief Vérifie un ping à la vitesse active
+     *
+     * Premier ping valide (CONFIRMING): passage en VERIFYING, délai
+     * réarmé, le sketch répond par le PONG. Second ping valide
+     * (VERIFYING): le PC a reçu le PONG, vitesse confirmée. Hors
+     * négociation, vérifie simplement la liaison.
+     *
+     * @param nonce Valeur choisie par le PC
+     * @param crc CRC reçu
+     * @param nowMs Heure courante (ms)
+     * @return true si crc == pingCrc(nonce, vitesse active)
+     */
+    bool confirm(uint32_t nonce, uint32_t crc, uint32_t nowMs);
+
+    /**
+     * @brief Négociation en cours (CONFIRMING ou VERIFYING)
+     */
+    bool isNegotiating() const;
+
+    /**
+     * @brief Délai de confirmation dépassé ?
+     *
+     * @param nowMs Heure courante (ms)
+     */
+    bool isExpired(uint32_t nowMs) const;
+
+    /**
+     * @brief Abandonne la vitesse non confirmée
+     *
+     * @return Vitesse à rétablir (dernière confirmée)
+     */
+    uint32_t fallBack();
+
+    /** @brief État courant */
+    State getState() const;
+
+    /** @brief Vitesse active (bps, éventuellement non confirmée) */
+    uint32_t getBaudrate() const;
+
+    /** @brief Dernière vitesse confirmée (bps) */
+    uint32_t getConfirmed() const;
+
+    /** @brief Vitesses confirmées depuis le démarrage */
+    uint16_t getSwitches() const;
+
+    /** @brief Replis depuis le démarrage */
+    uint16_t getFallbacks() const;
+
+private:
+    uint32_t confirmed_;  ///< Dernière vitesse confirmée
+    uint32_t active_;     ///< Vitesse active
+    uint32_t deadline_;   ///< Fin du délai de confirmation (ms)
+    State state_;         ///< État de la négociation
+    uint16_t switches_;   ///< Confirmations
+    uint16_t fallbacks_;  ///< Replis
+};
+
+#endif // LINK_RATE_H
@@ -0,0 +1,57 @@
+/**
+ * @file Metrics.cpp
+ * @brief Implémentation du registre de métriques
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "Metrics.h"
+
+namespace Metrics {
+
+    uint32_t values[COUNT] = {};
+
+    namespace {
+        /** @brief Libellés (rang = identifiant) */
+        const char* const LABELS[COUNT] = {
+#define METRICS_CATALOG_LABEL(name, label) label,
+            METRICS_CATALOG(METRICS_CATALOG_LABEL)
+#undef METRICS_CATALOG_LABEL
+        };
+
+        uint32_t lastDropped = 0U;  ///< Écritures perdues au mot précédent
+        uint32_t lastErrors = 0U;   ///< Erreurs de saisie au mot précédent
+
+        uint32_t saturate(uint32_t value, uint32_t max) {
+            return (value < max) ? value : max;
+        }
+    }
+
+    const char* labelOf(Id id) {
+        const uint8_t index = static_cast<uint8_t>(id);
+        return (index < COUNT) ? LABELS[index] : "?";
+    }
+
+    void reset() {
+        for (uint8_t i = 0U; i < COUNT; i++) {
+            __atomic_store_n(&values[i], 0U, __ATOMIC_RELAXED);
+        }
+        lastDropped = 0U;
+        lastErrors = 0U;
+    }
+
+    uint32_t packStatus() {
+        const uint32_t dropped = get(Id::FRAMES_DROPPED);
+        const uint32_t errors = get(Id::PARSE_ERRORS);
+
+        const uint32_t word = (saturate(get(Id::LOOP_RATE) / 100U, 0xFFU) << 24)
+                            | (saturate(get(Id::LOOP_MAX_US) / 100U, 0xFFU) << 16)
+                            | (saturate(get(Id::TX_QUEUE), 0xFFU) << 8)
+                            | (saturate(dropped - lastDropped, 0x0FU) << 4)
+                            | saturate(errors - lastErrors, 0x0FU);
+
+        lastDropped = dropped;
+        lastErrors = errors;
+        return word;
+    }
+}
@@ -0,0 +1,138 @@
+/**
+ * @file ModeBlend.cpp
+ * @brief Implémentation du fondu de répartition entre modes
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "ModeBlend.h"
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+ModeBlend::ModeBlend()
+    : from_()
+    , weight_()
+    , progress_(ONE)
+    , step_(ONE)
+    , mode_(PowerDistribution::FlightMode::DECOLLAGE)
+{
+    reset(mode_);
+}
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+void ModeBlend::setWindow(uint16_t windowMs, uint16_t tickMs) {
+    const uint16_t ticks = (tickMs == 0U) ? 0U : static_cast<uint16_t>(windowMs / tickMs);
+
+    // Au moins un pas de progression par tick
+    step_ = (ticks == 0U) ? ONE : ((ONE + ticks - 1) / ticks);
+}
+
+void ModeBlend::reset(PowerDistribution::FlightMode mode) {
+    mode_ = mode;
+    progress_ = ONE;
+
+    for (uint8_t m = 0U; m < MODE_COUNT; m++) {
+        weight_[m] = (m == static_cast<uint8_t>(mode)) ? ONE : 0;
+        from_[m] = weight_[m];
+    }
+}
+
+void ModeBlend::start(PowerDistribution::FlightMode mode) {
+    if (static_cast<uint8_t>(mode) >= MODE_COUNT) {
+        return;
+    }
+
+    // Repart des poids courants (éventuellement en plein fondu)
+    for (uint8_t m = 0U; m < MODE_COUNT; m++) {
+        from_[m] = weight_[m];
+    }
+
+    mode_ = mode;
+    progress_ = 0;
+}
+
+// ============================================================================
+// AVANCE PAR TICK
+// ============================================================================
+
+void ModeBlend::tick() {
+    if (progress_ >= ONE) {
+        return;
+    }
+
+    progress_ = ((ONE - progress_) < step_) ? ONE : (progress_ + step_);
+
+    for (uint8_t m = 0U; m < MODE_COUNT; m++) {
+        const int32_t to = (m == static_cast<uint8_t>(mode_)) ? ONE : 0;
+
+        // |to - from| ≤ 2^15, progress ≤ 2^15 : produit sur 31 bits
+        weight_[m] = from_[m] + (((to - from_[m]) * progress_) >> 15);
+    }
+}
+
+// ============================================================================
+// MÉLANGE
+// ============================================================================
+
+PowerAllocator::Allocation ModeBlend::mix(const PowerDistribution& distribution, uint16_t totalPower) const {
+    if (progress_ >= ONE) {
+        return distribution.allocate(mode_, totalPower);
+    }
+
+    uint32_t accumulator[PowerAllocator::SOURCE_COUNT] = {};
+
+    for (uint8_t m = 0U; m < MODE_COUNT; m++) {
+        if (weight_[m] <= 0) {
+            continue;
+        }
+
+        const PowerAllocator::Allocation allocation =
+            distribution.allocate(static_cast<PowerDistribution::FlightMode>(m), totalPower);
+
+        // Σ poids = 2^15, puissance ≤ 65535 : somme sur 32 bits
+        for (uint8_t s = 0U; s < PowerAllocator::SOURCE_COUNT; s++) {
+            accumulator[s] += static_cast<uint32_t>(weight_[m]) * allocation.power[s];
+        }
+    }
+
+    PowerAllocator::Allocation output = {};
+    for (uint8_t s = 0U; s < PowerAllocator::SOURCE_COUNT; s++) {
+        output.power[s] = static_cast<uint16_t>((accumulator[s] + (ONE / 2)) >> 15);
+        output.total = static_cast<uint16_t>(output.total + output.power[s]);
+    }
+
+    return output;
+}
+
+uint16_t ModeBlend::mixMax(const PowerDistribution& distribution, PowerAllocator::Source source) const {
+    if (progress_ >= ONE) {
+        return distribution.getProfile(mode_).getMax(source);
+    }
+
+    uint32_t accumulator = 0U;
+    for (uint8_t m = 0U; m < MODE_COUNT; m++) {
+        if (weight_[m] > 0) {
+            const uint16_t max = distribution.getProfile(static_cast<PowerDistribution::FlightMode>(m)).getMax(source);
+            accumulator += static_cast<uint32_t>(weight_[m]) * max;
+        }
+    }
+
+    return static_cast<uint16_t>((accumulator + (ONE / 2)) >> 15);
+}
+
+// ============================================================================
+// ACCESSEURS
+// ============================================================================
+
+PowerDistribution::FlightMode ModeBlend::getMode() const {
+    return mode_;
+}
+
+bool ModeBlend::isBlending() const {
+    return progress_ < ONE;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file ModeBlend.h
+ * @brief Transfert sans à-coup entre modes : fondu des répartitions
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#ifndef MODE_BLEND_H
+#define MODE_BLEND_H
+
+#include <stdint.h>
+#include "PowerDistribution.h"
+
+/**
+ * @brief Mélange pondéré des répartitions des modes
+ *
+ * L'état est un poids par mode (Q15, somme = 1). Un changement de mode
+ * fait glisser linéairement les poids de leur valeur courante vers le
+ * nouveau mode pendant la fenêtre de fondu ; chaque tick, la cible de
+ * chaque source est la moyenne pondérée des répartitions des modes pour
+ * la puissance totale du moment. Une nouvelle demande en cours de fondu
+ * repart simplement des poids courants : la consigne reste continue.
+ */
+class ModeBlend {
+public:
+    /**
+     * @brief Constructeur (mode DÉCOLLAGE, fondu immédiat)
+     */
+    ModeBlend();
+
+    /**
+     * @brief Définit la durée du fondu
+     *
+     * @param windowMs Durée (ms), 0 = changement immédiat
+     * @param tickMs Période d'appel de tick() (ms)
+     */
+    void setWindow(uint16_t windowMs, uint16_t tickMs);
+
+    /**
+     * @brief Bascule immédiatement sur un mode (sans fondu)
+     *
+     * @param mode Mode de vol
+     */
+    void reset(PowerDistribution::FlightMode mode);
+
+    /**
+     * @brief Démarre un fondu vers un mode depuis le mélange courant
+     *
+     * @param mode Mode de destination
+     */
+    void start(PowerDistribution::FlightMode mode);
+
+    /**
+     * @brief Avance le fondu d'une période
+     */
+    void tick();
+
+    /**
+     * @brief Répartition mélangée pour une puissance totale
+     *
+     * Arrondi au Cv le plus proche par source (écart ±1 Cv possible sur le
+     * total pendant le fondu). Hors fondu: identique à allocate() du mode.
+     *
+     * @param distribution Répartition par mode
+     * @param totalPower Puissance totale demandée (Cv)
+     * @return Allocation mélangée
+     */
+    PowerAllocator::Allocation mix(const PowerDistribution& distribution, uint16_t totalPower) const;
+
+    /**
+     * @brief Plafond mélangé d'une source (profils des modes)
+     *
+     * Moyenne pondérée des plafonds de la source dans chaque mode (0 si
+     * la source est absente du mode, ex. électrique en NORMAL). Hors
+     * fondu: plafond du mode de destination.
+     *
+     * @param distribution Répartition par mode
+     * @param source Source
+     * @return Plafond (Cv)
+     */
+    uint16_t mixMax(const PowerDistribution& distribution, PowerAllocator::Source source) const;
+
+    /**
+     * @brief Mode de destination
+     */
+    PowerDistribution::FlightMode getMode() const;
+
+    /**
+     * @brief Fondu en cours
+     */
+    bool isBlending() const;
+
+private:
+    /** @brief Nombre de modes mélangés */
+    static constexpr uint8_t MODE_COUNT = PowerDistribution::MODE_COUNT;
+
+    /** @brief Unité des poids et de la progression (Q15) */
+    static constexpr int32_t ONE = 32768;
+
+    int32_t from_[MODE_COUNT];     ///< Poids au début du fondu (Q15)
+    int32_t weight_[MODE_COUNT];   ///< Poids courants (Q15)
+    int32_t progress_;             ///< Avancement du fondu (Q15)
+    int32_t step_;                 ///< Avancement par tick (Q15), ONE = immédiat
+    PowerDistribution::FlightMode mode_;  ///< Mode de destination
+};
+
+#endif // MODE_BLEND_H
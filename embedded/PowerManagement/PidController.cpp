@@ -0,0 +1,83 @@
+/**
+ * @file PidController.cpp
+ * @brief Implémentation du régulateur PI/PID entier
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "PidController.h"
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+PidController::PidController()
+    : kp_(0)
+    , kiTick_(0)
+    , kdTick_(0)
+    , integrator_(0)
+    , limit_(0xFFFF)
+    , previous_(0U)
+{
+}
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+void PidController::configure(int16_t kp, int16_t ki, int16_t kd, uint16_t tickMs) {
+    const int32_t period = (tickMs == 0U) ? 1 : static_cast<int32_t>(tickMs);
+    kp_ = kp;
+    kiTick_ = static_cast<int32_t>(ki) * period;
+    kdTick_ = (static_cast<int32_t>(kd) * 1000) / period;
+}
+
+void PidController::setLimit(uint16_t max) {
+    limit_ = max;
+
+    // L'intégrateur ne doit pas garder une action impossible à appliquer
+    const int32_t bound = limit_ << 8;
+    integrator_ = (integrator_ > bound) ? bound : ((integrator_ < -bound) ? -bound : integrator_);
+}
+
+void PidController::reset(uint16_t measurement) {
+    integrator_ = 0;
+    previous_ = measurement;
+}
+
+// ============================================================================
+// RÉGULATION
+// ============================================================================
+
+uint16_t PidController::update(uint16_t setpoint, uint16_t measurement) {
+    const int32_t error = static_cast<int32_t>(setpoint) - static_cast<int32_t>(measurement);
+    const int32_t derivative = static_cast<int32_t>(measurement) - static_cast<int32_t>(previous_);
+    previous_ = measurement;
+
+    // Intégration (Q8): ki × e × dt, dt en ms
+    const int32_t step = static_cast<int32_t>((static_cast<int64_t>(kiTick_) * error) / 1000);
+    integrator_ += step;
+
+    const int32_t bound = limit_ << 8;
+    integrator_ = (integrator_ > bound) ? bound : ((integrator_ < -bound) ? -bound : integrator_);
+
+    // Somme en 64 bits: gains Q8 × erreur 16 bits peuvent dépasser 2^31
+    const int64_t action = ((static_cast<int64_t>(kp_) * error) + integrator_
+                          - (static_cast<int64_t>(kdTick_) * derivative)) >> 8;
+    int64_t command = static_cast<int64_t>(setpoint) + action;
+
+    // Saturation et intégration conditionnelle
+    if (command > limit_) {
+        command = limit_;
+        if (error > 0) {
+            integrator_ -= step;
+        }
+    } else if (command < 0) {
+        command = 0;
+        if (error < 0) {
+            integrator_ -= step;
+        }
+    }
+
+    return static_cast<uint16_t>(command);
+}
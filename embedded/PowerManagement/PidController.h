@@ -0,0 +1,71 @@
+/**
+ * @file PidController.h
+ * @brief Régulateur PI/PID entier avec anti-emballement
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#ifndef PID_CONTROLLER_H
+#define PID_CONTROLLER_H
+
+#include <stdint.h>
+
+/**
+ * @brief PID à période fixe, gains en Q8 (256 = 1,0)
+ *
+ * Commande = anticipation (consigne) + P + I + D, saturée dans [0, max].
+ * - I: intégrateur en Q8, gelé quand la commande est saturée dans le
+ *   sens de l'erreur (intégration conditionnelle) et borné à ±max ;
+ * - D: sur la mesure (pas d'à-coup lors d'un changement de consigne).
+ * update() est O(1) : quelques multiplications 32 bits, une division.
+ */
+class PidController {
+public:
+    /**
+     * @brief Constructeur (gains nuls : commande = consigne)
+     */
+    PidController();
+
+    /**
+     * @brief Définit les gains
+     *
+     * @param kp Gain proportionnel (Q8, sans unité)
+     * @param ki Gain intégral (Q8, par seconde)
+     * @param kd Gain dérivé (Q8, secondes)
+     * @param tickMs Période d'appel de update() (ms)
+     */
+    void configure(int16_t kp, int16_t ki, int16_t kd, uint16_t tickMs);
+
+    /**
+     * @brief Définit la commande maximale
+     *
+     * @param max Commande maximale (Cv)
+     */
+    void setLimit(uint16_t max);
+
+    /**
+     * @brief Vide l'intégrateur et la mémoire de dérivée
+     *
+     * @param measurement Mesure courante (Cv)
+     */
+    void reset(uint16_t measurement);
+
+    /**
+     * @brief Calcule la commande d'une période
+     *
+     * @param setpoint Consigne (Cv)
+     * @param measurement Puissance mesurée (Cv)
+     * @return Commande (Cv, dans [0, max])
+     */
+    uint16_t update(uint16_t setpoint, uint16_t measurement);
+
+private:
+    int32_t kp_;            ///< Gain proportionnel (Q8)
+    int32_t kiTick_;        ///< Gain intégral × période (Q8 × ms)
+    int32_t kdTick_;        ///< Gain dérivé / période (Q8 / ms × 1000)
+    int32_t integrator_;    ///< Terme intégral (Cv, Q8)
+    int32_t limit_;         ///< Commande maximale (Cv)
+    uint16_t previous_;     ///< Mesure précédente (Cv)
+};
+
+#endif // PID_CONTROLLER_H
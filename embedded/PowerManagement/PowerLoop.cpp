@@ -0,0 +1,139 @@
+/**
+ * @file PowerLoop.cpp
+ * @brief Implémentation de la boucle fermée de puissance
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "PowerLoop.h"
+#include "config.h"
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+PowerLoop::PowerLoop(uint16_t tickMs)
+    : pid_()
+    , sensor_()
+    , metrics_()
+    , command_()
+    , measured_()
+    , tickMs_(tickMs)
+{
+    pid_[static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)]
+        .configure(LOOP_ELECTRIC_KP, LOOP_ELECTRIC_KI, LOOP_ELECTRIC_KD, tickMs);
+    pid_[static_cast<uint8_t>(PowerAllocator::Source::THERMAL)]
+        .configure(LOOP_THERMAL_KP, LOOP_THERMAL_KI, LOOP_THERMAL_KD, tickMs);
+
+    for (uint8_t i = 0U; i < LOOP_COUNT; i++) {
+        sensor_[i] = nullptr;
+        metrics_[i].settled = true;
+    }
+}
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+void PowerLoop::setSensor(PowerAllocator::Source source, PowerSensor sensor) {
+    const uint8_t index = static_cast<uint8_t>(source);
+    if (index >= LOOP_COUNT) {
+        return;
+    }
+
+    sensor_[index] = sensor;
+    pid_[index].reset(measured_[index]);
+}
+
+void PowerLoop::setLimit(PowerAllocator::Source source, uint16_t max) {
+    const uint8_t index = static_cast<uint8_t>(source);
+    if (index < LOOP_COUNT) {
+        pid_[index].setLimit(max);
+    }
+}
+
+// ============================================================================
+// RÉGULATION
+// ============================================================================
+
+void PowerLoop::tick(const PowerDistribution::PowerOutput& setpoint) {
+    tickSource(static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC), setpoint.electric);
+    tickSource(static_cast<uint8_t>(PowerAllocator::Source::THERMAL), setpoint.thermal);
+}
+
+void PowerLoop::tickSource(uint8_t index, uint16_t setpoint) {
+    uint16_t measured = setpoint;
+
+    if ((sensor_[index] != nullptr)
+        && sensor_[index](static_cast<PowerAllocator::Source>(index), &measured)) {
+        command_[index] = pid_[index].update(setpoint, measured);
+    } else {
+        // Boucle ouverte: la consigne passe telle quelle
+        measured = setpoint;
+        command_[index] = setpoint;
+        pid_[index].reset(measured);
+    }
+
+    measured_[index] = measured;
+    updateMetrics(index, setpoint, measured);
+}
+
+// ============================================================================
+// MÉTRIQUES DE RÉPONSE
+// ============================================================================
+
+void PowerLoop::updateMetrics(uint8_t index, uint16_t setpoint, uint16_t measured) {
+    StepMetrics& metrics = metrics_[index];
+
+    // Nouvel échelon une fois le précédent établi ; en cours de réponse
+    // (consigne rampée), la cible suit sans relancer la mesure
+    if (setpoint != metrics.target) {
+        if (metrics.settled) {
+            metrics.elapsed = 0U;
+            metrics.settling = 0U;
+            metrics.overshoot = 0U;
+            metrics.rising = (setpoint > measured);
+        }
+        metrics.target = setpoint;
+    }
+
+    metrics.elapsed += tickMs_;
+
+    const int32_t error = static_cast<int32_t>(measured) - static_cast<int32_t>(setpoint);
+    const int32_t excess = metrics.rising ? error : -error;
+    if (excess > static_cast<int32_t>(metrics.overshoot)) {
+        metrics.overshoot = static_cast<uint16_t>(excess);
+    }
+
+    const uint32_t proportional = (static_cast<uint32_t>(setpoint) * LOOP_SETTLE_BAND_PERMILLE) / 1000U;
+    const int32_t band = static_cast<int32_t>((proportional > LOOP_SETTLE_BAND_MIN) ? proportional : LOOP_SETTLE_BAND_MIN);
+
+    metrics.settled = (error <= band) && (error >= -band);
+    if (!metrics.settled) {
+        metrics.settling = metrics.elapsed;
+    }
+}
+
+// ============================================================================
+// ACCESSEURS
+// ============================================================================
+
+PowerDistribution::PowerOutput PowerLoop::getCommand() const {
+    PowerDistribution::PowerOutput output;
+
+    output.electric = command_[static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)];
+    output.thermal = command_[static_cast<uint8_t>(PowerAllocator::Source::THERMAL)];
+    output.total = output.electric + output.thermal;
+
+    return output;
+}
+
+uint16_t PowerLoop::getMeasured(PowerAllocator::Source source) const {
+    const uint8_t index = static_cast<uint8_t>(source);
+    return (index < LOOP_COUNT) ? measured_[index] : 0U;
+}
+
+const PowerLoop::StepMetrics& PowerLoop::getMetrics(PowerAllocator::Source source) const {
+    const uint8_t index = static_cast<uint8_t>(source);
+    return metrics_[(index < LOOP_COUNT) ? index : 0U];
+}
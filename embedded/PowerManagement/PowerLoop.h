@@ -0,0 +1,126 @@
+/**
+ * @file PowerLoop.h
+ * @brief Boucle fermée de suivi de puissance par source (capteurs enfichables)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Chaîne: commandes PowerController (consignes) → PidController par source
+ * ← puissance mesurée par un capteur. Sans capteur branché, une source
+ * reste en boucle ouverte (commande = consigne).
+ */
+
+#ifndef POWER_LOOP_H
+#define POWER_LOOP_H
+
+#include <stdint.h>
+#include "PowerDistribution.h"
+#include "PidController.h"
+
+/**
+ * @brief Lecture de la puissance délivrée par une source
+ *
+ * @param source Source mesurée
+ * @param power Puissance mesurée (Cv), écrite si la lecture réussit
+ * @return true si la mesure est valide
+ */
+typedef bool (*PowerSensor)(PowerAllocator::Source source, uint16_t* power);
+
+/**
+ * @brief Régulation de la puissance électrique et thermique
+ *
+ * Mesure aussi la réponse indicielle de chaque source: dépassement et
+ * temps d'établissement dans une bande de ±LOOP_SETTLE_BAND_PERMILLE.
+ */
+class PowerLoop {
+public:
+    /**
+     * @brief Réponse au dernier échelon de consigne
+     */
+    struct StepMetrics {
+        uint16_t target;      ///< Consigne courante (Cv)
+        uint16_t overshoot;   ///< Dépassement maximal au-delà de la consigne (Cv)
+        uint32_t elapsed;     ///< Temps depuis l'échelon (ms)
+        uint32_t settling;    ///< Dernier instant hors bande depuis l'échelon (ms)
+        bool rising;          ///< Échelon montant
+        bool settled;         ///< Mesure actuellement dans la bande
+    };
+
+    /** @brief Nombre de sources régulées (électrique, thermique) */
+    static constexpr uint8_t LOOP_COUNT = 2U;
+
+    /**
+     * @brief Constructeur (gains config.h, aucun capteur)
+     *
+     * @param tickMs Période d'appel de tick() (ms)
+     */
+    explicit PowerLoop(uint16_t tickMs);
+
+    /**
+     * @brief Branche un capteur sur une source
+     *
+     * @param source ELECTRIC ou THERMAL
+     * @param sensor Fonction de lecture (nullptr = boucle ouverte)
+     */
+    void setSensor(PowerAllocator::Source source, PowerSensor sensor);
+
+    /**
+     * @brief Définit la commande maximale d'une source
+     *
+     * @param source ELECTRIC ou THERMAL
+     * @param max Commande maximale (Cv)
+     */
+    void setLimit(PowerAllocator::Source source, uint16_t max);
+
+    /**
+     * @brief Avance la régulation d'une période
+     *
+     * @param setpoint Consignes electric/thermal (Cv)
+     */
+    void tick(const PowerDistribution::PowerOutput& setpoint);
+
+    /**
+     * @brief Commandes appliquées aux actionneurs
+     *
+     * @return Commandes electric/thermal/total
+     */
+    PowerDistribution::PowerOutput getCommand() const;
+
+    /**
+     * @brief Dernière puissance mesurée d'une source
+     *
+     * @param source ELECTRIC ou THERMAL
+     * @return Mesure (Cv), consigne en boucle ouverte
+     */
+    uint16_t getMeasured(PowerAllocator::Source source) const;
+
+    /**
+     * @brief Réponse au dernier échelon d'une source
+     *
+     * @param source ELECTRIC ou THERMAL
+     */
+    const StepMetrics& getMetrics(PowerAllocator::Source source) const;
+
+private:
+    static_assert(static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC) == 0U
+                  && static_cast<uint8_t>(PowerAllocator::Source::THERMAL) == 1U,
+                  "PowerLoop indexe les sources ELECTRIC/THERMAL en 0/1");
+
+    PidController pid_[LOOP_COUNT];        ///< Régulateur par source
+    PowerSensor sensor_[LOOP_COUNT];       ///< Capteur par source
+    StepMetrics metrics_[LOOP_COUNT];      ///< Réponse indicielle par source
+    uint16_t command_[LOOP_COUNT];         ///< Dernière commande (Cv)
+    uint16_t measured_[LOOP_COUNT];        ///< Dernière mesure (Cv)
+    uint16_t tickMs_;                      ///< Période (ms)
+
+    /**
+     * @brief Régule une source
+     */
+    void tickSource(uint8_t index, uint16_t setpoint);
+
+    /**
+     * @brief Met à jour dépassement et temps d'établissement
+     */
+    void updateMetrics(uint8_t index, uint16_t setpoint, uint16_t measured);
+};
+
+#endif // POWER_LOOP_H
@@ -14,6 +14,24 @@
  * - '+' : Augmenter puissance (+10 Cv)
  * - '-' : Diminuer puissance (-10 Cv)
  * - 's' : Afficher status complet
+ * - 't' : Vider la boîte noire (trace des derniers événements)
+ * - 'a' : Activer/désactiver le flux ARINC périodique (commandes moteurs)
+ * - 'l' : Activer/désactiver la compensation du retard turbine
+ * - 'p' : Lancer/arrêter le programme de vol (MissionSchedule.h)
+ * - 'g' : Reprendre le programme suspendu par une commande opérateur
+ * - 'm' : Métriques de santé (boucles/s, octets TX/RX, erreurs...)
+ * - 'q' : Statistiques d'utilisation par mode (temps, bandes de puissance)
+ * - 'c' : Afficher les courbes de calibration
+ * - 'c <source> <shift> <n> <w0> ... <wn-1>' : Charger une courbe
+ *         (source 0 = électrique, 1 = thermique ; pas = 2^shift Cv ; points en W)
+ * - 'k' : Afficher les limites par mode
+ * - 'k <27 valeurs> <crc>' : Charger les limites (9 champs par mode, ordre
+ *         DÉCOLLAGE/NORMAL/URGENCE ; ligne générée par tools/limits_line.py)
+ * - 'b' : Vitesse série active et compteurs de négociation
+ * - 'b <bps>' : Proposer 460800 / 921600 / 2000000 (ou SERIAL_BAUDRATE) ;
+ *         acquitté puis bascule ; 'b <nonce> <crc>' (PONG) puis un second
+ *         ping confirment (LinkRate.h, côté PC: tools/link_negotiate.py),
+ *         sinon repli automatique
  * - 'h' : Afficher aide
  * - 'r' : Reset système
  * 
@@ -24,14 +42,47 @@
 #include "PowerDistribution.h"
 #include "FlightMode.h"
 #include "ARINCSimulator.h"
+#include "Hal.h"
+#include "TraceBuffer.h"
+#include "LogCatalog.h"
+#include "Calibration.h"
+#include "PowerController.h"
+#include "BatteryModel.h"
+#include "PowerLoop.h"
+#include "SchedulePlayer.h"
+#include "UsageStats.h"
+#include "Metrics.h"
+#include "SerialLink.h"
+#include "MissionSchedule.h"
+#include "StateJournal.h"
+#include "ModeLimits.h"
+#include "PowerState.h"
+#include "TopicBus.h"
+#include "LinkRate.h"
 
 // ============================================================================
 // INSTANCES GLOBALES
 // ============================================================================
 
 PowerDistribution powerCalc;      ///< Calculateur de distribution
-FlightMode flightMode;             ///< Gestionnaire de mode de vol
-ARINCSimulator arinc;              ///< Simulateur ARINC 429
+CalibrationCurve electricCurve(CalibrationCurve::Source::ELECTRIC);  ///< Calibration moteur
+CalibrationCurve thermalCurve(CalibrationCurve::Source::THERMAL);    ///< Calibration turbine
+PowerState powerState(powerCalc, electricCurve, thermalCurve);     ///< Mode, consigne et répartition mémorisée
+PowerController controller(powerCalc);  ///< Rampes de consigne par source
+BatteryModel battery(CONTROL_TICK_INTERVAL);  ///< État de charge et limites batterie
+PowerLoop powerLoop(CONTROL_TICK_INTERVAL);   ///< Boucle fermée par source (capteurs)
+SchedulePlayer schedule(CONTROL_TICK_INTERVAL);  ///< Programme de vol (autothrottle)
+SerialLink link(Serial);           ///< Port série instrumenté (métriques)
+ARINCSimulator arinc(link);        ///< Simulateur ARINC 429
+TraceBuffer blackBox HAL_NOINIT;   ///< Boîte noire (survit au reset watchdog)
+UsageStats usage HAL_NOINIT;       ///< Statistiques d'utilisation (survivent aux resets à chaud)
+StateJournal journal;              ///< État persistant (mode, consigne, calibration, statistiques)
+LinkRate linkRate;                 ///< Vitesse série négociée ('b')
+
+// Abonnés du bus interne (interrogés par leur tâche, hors tick de contrôle)
+TopicBus::Subscriber<TopicBus::Topic::COMMAND> arincCommandFeed;  ///< Flux ARINC: commandes
+TopicBus::Subscriber<TopicBus::Topic::BATTERY> arincBatteryFeed;  ///< Flux ARINC: batterie
+TopicBus::Subscriber<TopicBus::Topic::COMMAND> usageFeed;         ///< Statistiques d'utilisation
 
 // ============================================================================
 // VARIABLES GLOBALES
@@ -39,41 +90,147 @@ ARINCSimulator arinc;              ///< Simulateur ARINC 429
 
 unsigned long lastUpdateTime = 0;      ///< Dernier update affichage (ms)
 unsigned long lastARINCTime = 0;       ///< Dernière transmission ARINC (ms)
+unsigned long lastControlTime = 0;     ///< Dernier tick de contrôle (ms)
+unsigned long lastStatusTime = 0;      ///< Dernier mot d'état système (ms)
+uint8_t arincMode = 0xFFU;             ///< Dernier mode émis par le flux ARINC (0xFF = aucun)
+unsigned long lastMetricsTime = 0;     ///< Début de la fenêtre de métriques (ms)
+uint32_t loopCount = 0U;               ///< Tours de boucle dans la fenêtre
+uint16_t txQueuePeak = 0U;             ///< File TX maximale dans la fenêtre (octets)
+uint32_t idleTimeUs = 0U;              ///< Temps en veille dans la fenêtre (µs)
+bool ledOn = true;                     ///< État de la LED de vie
+uint32_t tracedVersion = 0U;           ///< Version de PowerState de la dernière trace SETPOINT
+unsigned long stateChangeTime = 0;     ///< Dernière modification de l'état opérateur (ms)
+unsigned long lastUsageSaveTime = 0;   ///< Dernier enregistrement des statistiques (ms)
+StateJournal::State pendingState = {}; ///< État opérateur courant, à enregistrer une fois stable
+bool arincStreaming = false;           ///< Flux ARINC périodique actif
 bool systemReady = false;              ///< Flag système initialisé
 
 String serialBuffer = "";              ///< Buffer de réception série
 
+/** @brief États de la saisie d'une ligne d'arguments ('c', 'k', 'b') */
+enum LineInputState : uint8_t {
+    LINE_IDLE = 0U,       ///< Pas de saisie en cours
+    LINE_RECEIVING = 1U,  ///< Réception des champs
+    LINE_DISCARD = 2U     ///< Ligne rejetée, ignorée jusqu'à la fin
+};
+
+LineInputState lineState = LINE_IDLE;               ///< Saisie d'une ligne
+char lineCommand = 'c';                             ///< Commande en saisie ('c', 'k' ou 'b')
+uint16_t lineField = 0U;                            ///< Rang du champ suivant
+CalibrationCurve* calibrationTarget = nullptr;      ///< Courbe en chargement
+uint8_t calibrationShift = 0U;                      ///< log2(pas) reçu
+uint32_t limitsCrc = 0U;                            ///< CRC reçu (dernier champ de 'k')
+uint32_t linkFields[2] = { 0U, 0U };                ///< Champs de 'b' (vitesse, ou nonce et CRC)
+
+/** @brief Identifiants des tâches surveillées (champ A des traces OVERRUN) */
+enum TaskId : uint8_t {
+    TASK_SERIAL = 0U,   ///< handleSerialInput()
+    TASK_DISPLAY = 1U,  ///< updateDisplay()
+    TASK_ARINC = 2U,    ///< sendARINCData()
+    TASK_CONTROL = 3U,  ///< controlTick()
+    TASK_JOURNAL = 4U   ///< persistState()
+};
+
+/** @brief Texte d'aide ('h' et démarrage), une entrée par ligne */
+const char* const HELP_TEXT[] = {
+    "",
+    "╔════════════════════════════════════════════════════════════════╗",
+    "║                      COMMANDES DISPONIBLES                     ║",
+    "╠════════════════════════════════════════════════════════════════╣",
+    "║  MODES DE VOL:                                                 ║",
+    "║    d - Mode DÉCOLLAGE (Electric 0-1000, Thermal 0-2250)       ║",
+    "║    n - Mode NORMAL (Thermal only 0-2750)                       ║",
+    "║    u - Mode URGENCE (Electric 0-1000, Thermal 0-2750)         ║",
+    "║                                                                ║",
+    "║  CONTRÔLE PUISSANCE:                                           ║",
+    "║    + - Augmenter puissance (+10 Cv)                            ║",
+    "║    - - Diminuer puissance (-10 Cv)                             ║",
+    "║    <nombre> - Définir puissance exacte (ex: 1500)              ║",
+    "║                                                                ║",
+    "║  SYSTÈME:                                                      ║",
+    "║    s - Afficher status complet + dashboard                     ║",
+    "║    t - Vider la boîte noire (derniers événements)              ║",
+    "║    m - Métriques de santé (boucles/s, octets, erreurs)         ║",
+    "║    q - Statistiques d'utilisation (temps par mode et bande)    ║",
+    "║    a - Flux ARINC périodique on/off (commandes moteurs)        ║",
+    "║    l - Compensation retard turbine on/off                      ║",
+    "║    p - Programme de vol on/off (g - reprendre après commande)  ║",
+    "║    c - Courbes de calibration (c <src> <shift> <n> <W...>)     ║",
+    "║    k - Limites par mode (k <27 valeurs> <crc> pour charger)    ║",
+    "║    b - Vitesse série (b <bps>, ping: b <nonce> <crc>)          ║",
+    "║    h - Afficher cette aide                                     ║",
+    "║    r - Reset système                                           ║",
+    "╚════════════════════════════════════════════════════════════════╝",
+    ""
+};
+
+/** @brief Nombre de lignes d'aide */
+const uint8_t HELP_LINE_COUNT = sizeof(HELP_TEXT) / sizeof(HELP_TEXT[0]);
+
+/** @brief Étapes de l'affichage de démarrage (basse priorité, après le contrôle) */
+enum BootStage : uint8_t {
+    BOOT_BANNER = 0U,   ///< Banner, une ligne par passage
+    BOOT_TRACE = 1U,    ///< Vidange boîte noire (après reset watchdog)
+    BOOT_STATUS = 2U,   ///< Status initial
+    BOOT_HELP = 3U,     ///< Aide, une ligne par passage
+    BOOT_READY = 4U,    ///< Messages système prêt et temps de démarrage
+    BOOT_DONE = 5U      ///< Affichage terminé
+};
+
+BootStage bootStage = BOOT_BANNER;     ///< Étape d'affichage en cours
+uint8_t bootLine = 0U;                 ///< Ligne suivante de l'étape
+bool traceRecovered = false;           ///< Boîte noire conservée (reset watchdog)
+bool stateRestored = false;            ///< Mode et consigne repris du journal
+uint32_t bootOutputUs = 0U;            ///< Reset → première commande valide (µs)
+
 // ============================================================================
 // SETUP
 // ============================================================================
 
 void setup() {
-    // Initialisation LED status
-    pinMode(LED_STATUS_PIN, OUTPUT);
-    digitalWrite(LED_STATUS_PIN, LOW);
+    // Boîte noire conservée uniquement après un reset watchdog
+    Hal::ResetCause resetCause = Hal::readResetCause();
+    traceRecovered = blackBox.begin(resetCause == Hal::ResetCause::WATCHDOG);
+    blackBox.record(TraceBuffer::Event::BOOT, static_cast<uint16_t>(resetCause), 0U);
+    bool usagePreserved = usage.begin(resetCause != Hal::ResetCause::POWER_ON);
     
-    // Initialisation Serial/ARINC
-    arinc.begin(SERIAL_BAUDRATE);
+    // Étape 1: chaîne de contrôle (mode par défaut DÉCOLLAGE), avant toute sortie texte
+    powerState.setMode(PowerDistribution::FlightMode::DECOLLAGE);
+    powerState.setTotalPower(DecollageConfig::INITIAL_POWER);
+    restoreJournal(!usagePreserved);
+    powerLoop.setSensor(PowerAllocator::Source::ELECTRIC, readPowerSensor);
+    powerLoop.setSensor(PowerAllocator::Source::THERMAL, readPowerSensor);
+    applyBatteryLimit();
+    controller.reset(powerState.getMode(), powerState.getTotalPower());
+    schedule.load(MISSION_SCHEDULE, MISSION_SCHEDULE_COUNT);
     
-    // Banner système
-    arinc.sendSystemBanner();
+    // Premier tick: commandes valides écrites sur les sorties
+    controlTick();
+    recordUsage();
+    bootOutputUs = Hal::micros();
+    Metrics::set(Metrics::Id::BOOT_US, bootOutputUs);
+    lastControlTime = millis();
+    lastMetricsTime = lastControlTime;
+    lastUsageSaveTime = lastControlTime;
+    stateChangeTime = lastControlTime;
+    pendingState = currentState();
     
-    // Initialisation mode par défaut (DÉCOLLAGE)
-    flightMode.setMode(PowerDistribution::FlightMode::DECOLLAGE);
-    flightMode.setTotalPower(DecollageConfig::INITIAL_POWER);
-    
-    // Status initial
-    sendCurrentStatus();
-    
-    // Affichage aide
-    printHelp();
+    // Étape 2: LED et liaison série (sans attente)
+    pinMode(LED_STATUS_PIN, OUTPUT);
+    digitalWrite(LED_STATUS_PIN, HIGH);
+    arinc.begin(SERIAL_BAUDRATE);
     
-    // Système prêt
+    // Sources de réveil de la veille (l'UART réveille par sa propre interruption)
+    Hal::wakeOnPin(ENCODER_CLK_PIN);
+    Hal::wakeOnPin(ENCODER_DT_PIN);
+    Hal::wakeOnPin(BUTTON_NORMAL_PIN);
+    Hal::wakeOnPin(BUTTON_URGENCE_PIN);
     systemReady = true;
-    digitalWrite(LED_STATUS_PIN, HIGH);
     
-    Serial.println(F("[SYSTEM] Système opérationnel"));
-    Serial.println(F(""));
+    // Étape 3: banner, status et aide différés dans loop() (pumpBootOutput)
+    
+    // Watchdog armé une fois l'initialisation terminée
+    Hal::watchdogBegin(WATCHDOG_INTERVAL);
 }
 
 // ============================================================================
@@ -82,27 +239,73 @@ void setup() {
 
 void loop() {
     unsigned long currentTime = millis();
+    uint32_t loopStart = Hal::micros();
+    uint32_t taskStart = 0U;
+    
+    Hal::watchdogKick();
     
     // Lecture commandes série
+    taskStart = Hal::micros();
     handleSerialInput();
+    checkTaskBudget(TASK_SERIAL, taskStart);
+    
+    // Vitesse négociée non confirmée dans le délai (ping ou second ping): repli
+    if (linkRate.isExpired(currentTime)) {
+        fallBackLink();
+    }
+    
+    // Tâche de contrôle à cadence fixe (CONTROL_TICK_INTERVAL = 20ms, rattrapage sans dérive)
+    while (currentTime - lastControlTime >= CONTROL_TICK_INTERVAL) {
+        lastControlTime += CONTROL_TICK_INTERVAL;
+        taskStart = Hal::micros();
+        controlTick();
+        checkTaskBudget(TASK_CONTROL, taskStart);
+        recordUsage();
+    }
     
     // Update périodique affichage (100ms)
     if (currentTime - lastUpdateTime >= DISPLAY_UPDATE_INTERVAL) {
         lastUpdateTime = currentTime;
+        taskStart = Hal::micros();
         updateDisplay();
+        checkTaskBudget(TASK_DISPLAY, taskStart);
     }
     
     // Transmission ARINC périodique (50ms)
     if (currentTime - lastARINCTime >= ARINC_TX_INTERVAL) {
         lastARINCTime = currentTime;
+        taskStart = Hal::micros();
         sendARINCData();
+        checkTaskBudget(TASK_ARINC, taskStart);
     }
     
-    // Heartbeat LED
-    if ((currentTime / 500) % 2 == 0) {
-        digitalWrite(LED_STATUS_PIN, HIGH);
-    } else {
-        digitalWrite(LED_STATUS_PIN, LOW);
+    // Persistance (état stable, statistiques périodiques)
+    if (journal.isAvailable()) {
+        taskStart = Hal::micros();
+        persistState(currentTime);
+        checkTaskBudget(TASK_JOURNAL, taskStart);
+    }
+    
+    // Heartbeat LED (écriture au changement d'état seulement)
+    bool led = ((currentTime / LED_HEARTBEAT_INTERVAL) % 2 == 0);
+    if (led != ledOn) {
+        ledOn = led;
+        digitalWrite(LED_STATUS_PIN, led ? HIGH : LOW);
+    }
+    
+    // Affichage de démarrage: basse priorité, jamais avant un tick dû
+    if (bootStage != BOOT_DONE && (millis() - lastControlTime) < CONTROL_TICK_INTERVAL) {
+        pumpBootOutput();
+    }
+    
+    // Émission série: files par priorité → UART, sans attendre la ligne
+    link.pump();
+    
+    updateLoopMetrics(currentTime, loopStart);
+    
+    // Veille jusqu'à la prochaine échéance ou une entrée
+    if (LOW_POWER_IDLE != 0 && bootStage == BOOT_DONE) {
+        idleUntilNextDeadline(currentTime, loopStart);
     }
 }
 
@@ -111,8 +314,20 @@ void loop() {
 // ============================================================================
 
 void handleSerialInput() {
-    while (Serial.available() > 0) {
-        char inChar = (char)Serial.read();
+    while (link.available() > 0) {
+        char inChar = (char)link.read();
+        
+        // Bascule de vitesse: octets parasites ignorés jusqu'aux pings ('b')
+        if (linkRate.isNegotiating()
+            && lineState == LINE_IDLE && inChar != 'b' && inChar != 'B') {
+            continue;
+        }
+        
+        // Ligne d'arguments en cours de saisie
+        if (lineState != LINE_IDLE) {
+            handleLineInput(inChar);
+            continue;
+        }
         
         // Commandes directes (caractères uniques)
         if (inChar == '\n' || inChar == '\r') {
@@ -133,54 +348,164 @@ void handleSerialInput() {
 }
 
 void processCommand(char cmd) {
+    if (cmd != ' ' && cmd != '\t') {
+        Metrics::add(Metrics::Id::COMMANDS);
+    }
+    
     switch (cmd) {
         // Changement de mode
         case 'd':
         case 'D':
-            flightMode.setMode(PowerDistribution::FlightMode::DECOLLAGE);
-            Serial.println(F("\n[CMD] Changement mode → DÉCOLLAGE"));
+            suspendSchedule();
+            changeMode(PowerDistribution::FlightMode::DECOLLAGE);
+            arinc.sendLog(LogId::CMD_MODE, PowerDistribution::FlightMode::DECOLLAGE);
             arinc.sendFlightMode(PowerDistribution::FlightMode::DECOLLAGE);
             sendCurrentStatus();
             break;
         
         case 'n':
         case 'N':
-            flightMode.setMode(PowerDistribution::FlightMode::NORMAL);
-            Serial.println(F("\n[CMD] Changement mode → NORMAL"));
+            suspendSchedule();
+            changeMode(PowerDistribution::FlightMode::NORMAL);
+            arinc.sendLog(LogId::CMD_MODE, PowerDistribution::FlightMode::NORMAL);
             arinc.sendFlightMode(PowerDistribution::FlightMode::NORMAL);
             sendCurrentStatus();
             break;
         
         case 'u':
         case 'U':
-            flightMode.setMode(PowerDistribution::FlightMode::URGENCE);
-            Serial.println(F("\n[CMD] Changement mode → URGENCE"));
+            suspendSchedule();
+            changeMode(PowerDistribution::FlightMode::URGENCE);
+            arinc.sendLog(LogId::CMD_MODE, PowerDistribution::FlightMode::URGENCE);
             arinc.sendFlightMode(PowerDistribution::FlightMode::URGENCE);
             sendCurrentStatus();
             break;
         
         // Ajustement puissance
-        case '+':
-            flightMode.increasePower(ENCODER_STEP);
-            Serial.print(F("\n[CMD] Puissance +"));
-            Serial.print(ENCODER_STEP);
-            Serial.println(F(" Cv"));
+        case '+': {
+            suspendSchedule();
+            uint32_t requested = static_cast<uint32_t>(powerState.getTotalPower()) + ENCODER_STEP;
+            powerState.increasePower(ENCODER_STEP);
+            traceSetpoint(requested);
+            arinc.sendLog(LogId::CMD_POWER_UP, ENCODER_STEP);
             sendCurrentStatus();
             break;
+        }
         
         case '-':
-            flightMode.decreasePower(ENCODER_STEP);
-            Serial.print(F("\n[CMD] Puissance -"));
-            Serial.print(ENCODER_STEP);
-            Serial.println(F(" Cv"));
+            suspendSchedule();
+            powerState.decreasePower(ENCODER_STEP);
+            traceSetpoint(powerState.getTotalPower());
+            arinc.sendLog(LogId::CMD_POWER_DOWN, ENCODER_STEP);
             sendCurrentStatus();
             break;
         
         // Status système
         case 's':
         case 'S':
-            Serial.println(F("\n[CMD] Status système complet"));
+            arinc.sendLog(LogId::CMD_STATUS);
             sendFullDashboard();
+            arinc.sendBattery(
+                TopicBus::read<TopicBus::Topic::BATTERY>().soc,
+                TopicBus::read<TopicBus::Topic::BATTERY>().boostTime
+            );
+            arinc.sendLog(
+                LogId::SCHEDULE_STATUS,
+                schedule.getState(),
+                schedule.getIndex() + 1U,
+                schedule.getCount(),
+                schedule.getRemaining() / 1000UL
+            );
+            break;
+        
+        // Boîte noire
+        case 't':
+        case 'T':
+            arinc.sendLog(LogId::CMD_TRACE_DUMP);
+            arinc.sendTrace(blackBox);
+            break;
+        
+        // Métriques de santé
+        case 'm':
+        case 'M':
+            arinc.sendLog(LogId::CMD_METRICS);
+            arinc.sendMetrics();
+            arinc.sendTopics();
+            arinc.sendOutputClasses();
+            break;
+        
+        // Statistiques d'utilisation
+        case 'q':
+        case 'Q':
+            arinc.sendLog(LogId::CMD_USAGE);
+            arinc.sendUsage(usage, CONTROL_TICK_INTERVAL);
+            break;
+        
+        // Flux ARINC périodique
+        case 'a':
+        case 'A':
+            arincStreaming = !arincStreaming;
+            arincMode = 0xFFU;  // Mode émis dès la première trame
+            arinc.sendLog(LogId::CMD_ARINC_STREAM, arincStreaming ? 1U : 0U);
+            break;
+        
+        // Compensation du retard turbine par l'électrique
+        case 'l':
+        case 'L':
+            controller.setCompensation(!controller.isCompensating());
+            arinc.sendLog(LogId::CMD_SPOOL_COMPENSATION, controller.isCompensating() ? 1U : 0U);
+            break;
+        
+        // Programme de vol: lancement / arrêt
+        case 'p':
+        case 'P':
+            if (schedule.getState() == SchedulePlayer::State::PLAYING
+                || schedule.getState() == SchedulePlayer::State::OVERRIDDEN) {
+                schedule.stop();
+                controller.setElectricOverride(PowerController::ELECTRIC_AUTO);
+                arinc.sendLog(LogId::CMD_SCHEDULE, 0U);
+            } else if (schedule.start()) {
+                arinc.sendLog(LogId::CMD_SCHEDULE, 1U);
+                applyScheduleEntry();
+            } else {
+                arinc.sendLog(LogId::ERROR_SCHEDULE);
+            }
+            break;
+        
+        // Programme de vol: reprise après commande opérateur
+        case 'g':
+        case 'G':
+            if (schedule.resume()) {
+                arinc.sendLog(LogId::CMD_SCHEDULE, 1U);
+                applyScheduleEntry();
+            } else {
+                arinc.sendLog(LogId::ERROR_SCHEDULE);
+            }
+            break;
+        
+        // Calibration (affichage ou chargement selon la suite de la ligne)
+        case 'c':
+        case 'C':
+            lineState = LINE_RECEIVING;
+            lineCommand = 'c';
+            lineField = 0U;
+            calibrationTarget = nullptr;
+            break;
+        
+        // Limites par mode (affichage ou chargement selon la suite de la ligne)
+        case 'k':
+        case 'K':
+            lineState = LINE_RECEIVING;
+            lineCommand = 'k';
+            lineField = 0U;
+            break;
+        
+        // Vitesse série (affichage, proposition ou ping selon la suite de la ligne)
+        case 'b':
+        case 'B':
+            lineState = LINE_RECEIVING;
+            lineCommand = 'b';
+            lineField = 0U;
             break;
         
         // Aide
@@ -193,15 +518,15 @@ void processCommand(char cmd) {
         // Reset
         case 'r':
         case 'R':
-            Serial.println(F("\n[CMD] Reset système..."));
+            arinc.sendLog(LogId::CMD_RESET);
             resetSystem();
             break;
         
         default:
             // Commande inconnue
             if (cmd != ' ' && cmd != '\t') {
-                Serial.print(F("\n[WARN] Commande inconnue: "));
-                Serial.println(cmd);
+                Metrics::add(Metrics::Id::PARSE_ERRORS);
+                arinc.sendLog(LogId::WARN_UNKNOWN_CMD, cmd);
             }
             break;
     }
@@ -210,24 +535,275 @@ void processCommand(char cmd) {
 void processNumberInput(String numberStr) {
     long value = numberStr.toInt();
     
+    Metrics::add(Metrics::Id::COMMANDS);
+    
     if (value < 0) {
-        Serial.println(F("\n[ERROR] Valeur négative invalide"));
+        Metrics::add(Metrics::Id::PARSE_ERRORS);
+        arinc.sendLog(LogId::ERROR_NEGATIVE);
         return;
     }
     
     if (value > 65535) {
-        Serial.println(F("\n[ERROR] Valeur trop grande (max 65535)"));
+        Metrics::add(Metrics::Id::PARSE_ERRORS);
+        arinc.sendLog(LogId::ERROR_TOO_LARGE, 65535U);
         return;
     }
     
-    flightMode.setTotalPower((uint16_t)value);
-    Serial.print(F("\n[CMD] Puissance définie: "));
-    Serial.print(value);
-    Serial.println(F(" Cv"));
+    suspendSchedule();
+    powerState.setTotalPower((uint16_t)value);
+    traceSetpoint(static_cast<uint32_t>(value));
+    arinc.sendLog(LogId::CMD_POWER_SET, value);
     
     sendCurrentStatus();
 }
 
+// ============================================================================
+// CALIBRATION
+// ============================================================================
+
+void handleLineInput(char inChar) {
+    if (inChar >= '0' && inChar <= '9') {
+        if (lineState == LINE_RECEIVING) {
+            serialBuffer += inChar;
+        }
+        return;
+    }
+    
+    bool endOfLine = (inChar == '\n' || inChar == '\r');
+    bool separator = (inChar == ' ' || inChar == ',' || inChar == '\t');
+    
+    if (!endOfLine && !separator) {
+        // Caractère invalide: ligne rejetée
+        if (lineState == LINE_RECEIVING) {
+            rejectLine();
+        }
+        serialBuffer = "";
+        return;
+    }
+    
+    if (serialBuffer.length() > 0 && lineState == LINE_RECEIVING) {
+        // strtoul: valeurs 32 bits complètes (CRC, puissances en W)
+        uint32_t value = static_cast<uint32_t>(strtoul(serialBuffer.c_str(), nullptr, 10));
+        if (lineCommand == 'k') {
+            feedLimitsValue(value);
+        } else if (lineCommand == 'b') {
+            feedLinkValue(value);
+        } else {
+            feedCalibrationValue(value);
+        }
+    }
+    serialBuffer = "";
+    
+    if (endOfLine) {
+        if (lineState == LINE_RECEIVING && lineCommand == 'k') {
+            finishLimitsInput();
+        } else if (lineState == LINE_RECEIVING && lineCommand == 'b') {
+            finishLinkInput();
+        } else if (lineState == LINE_RECEIVING) {
+            finishCalibrationInput();
+        }
+        lineState = LINE_IDLE;
+    }
+}
+
+void rejectLine() {
+    Metrics::add(Metrics::Id::PARSE_ERRORS);
+    const LogId error = (lineCommand == 'k') ? LogId::ERROR_LIMITS
+                      : (lineCommand == 'b') ? LogId::ERROR_LINK
+                      : LogId::ERROR_CALIBRATION;
+    arinc.sendLog(error, lineField);
+    lineState = LINE_DISCARD;
+}
+
+void feedCalibrationValue(uint32_t value) {
+    bool accepted = true;
+    
+    if (lineField == 0U) {
+        // Source
+        if (value == static_cast<uint32_t>(CalibrationCurve::Source::ELECTRIC)) {
+            calibrationTarget = &electricCurve;
+        } else if (value == static_cast<uint32_t>(CalibrationCurve::Source::THERMAL)) {
+            calibrationTarget = &thermalCurve;
+        } else {
+            accepted = false;
+        }
+    } else if (lineField == 1U) {
+        // log2 du pas de grille
+        accepted = (value <= CALIBRATION_MAX_SHIFT);
+        calibrationShift = static_cast<uint8_t>(value);
+    } else if (lineField == 2U) {
+        // Nombre de points
+        accepted = (value <= CALIBRATION_MAX_POINTS)
+            && calibrationTarget->beginLoad(calibrationShift, static_cast<uint16_t>(value));
+    } else {
+        // Points (W)
+        accepted = calibrationTarget->appendPoint(value);
+    }
+    
+    if (!accepted) {
+        rejectLine();
+        return;
+    }
+    
+    lineField++;
+}
+
+void finishCalibrationInput() {
+    // 'c' seul: affichage des courbes actives
+    if (lineField == 0U) {
+        const PowerState::Snapshot& state = powerState.snapshot();
+        arinc.sendCalibration(electricCurve, state.output.electric);
+        arinc.sendCalibration(thermalCurve, state.output.thermal);
+        return;
+    }
+    
+    if (lineField < 3U || !calibrationTarget->commitLoad()) {
+        rejectLine();
+        return;
+    }
+    
+    arinc.sendLog(
+        LogId::CMD_CALIBRATION,
+        calibrationTarget->getSource(),
+        calibrationTarget->getCount(),
+        calibrationTarget->getStep()
+    );
+    
+    // Chargement rare: écrit directement en pages flash (effacement bloquant)
+    Hal::watchdogKick();
+    if (journal.saveCalibration(*calibrationTarget)) {
+        Metrics::add(Metrics::Id::JOURNAL_COMMITS);
+    }
+}
+
+// ============================================================================
+// LIMITES PAR MODE
+// ============================================================================
+
+void feedLimitsValue(uint32_t value) {
+    // 27 champs dans le tampon inactif, puis le CRC
+    if (lineField == 0U) {
+        ModeLimits::beginEdit();
+    }
+    
+    if (lineField < ModeLimits::FIELD_COUNT) {
+        if (value > 0xFFFFUL || !ModeLimits::setField(static_cast<uint8_t>(lineField), static_cast<uint16_t>(value))) {
+            rejectLine();
+            return;
+        }
+    } else if (lineField == ModeLimits::FIELD_COUNT) {
+        limitsCrc = value;
+    } else {
+        rejectLine();
+        return;
+    }
+    
+    lineField++;
+}
+
+void finishLimitsInput() {
+    // 'k' seul: affichage de la table active
+    if (lineField == 0U) {
+        arinc.sendLimits(ModeLimits::active(), ModeLimits::getGeneration());
+        return;
+    }
+    
+    if (lineField != ModeLimits::FIELD_COUNT + 1U) {
+        rejectLine();
+        return;
+    }
+    
+    const uint8_t invalid = ModeLimits::stage(limitsCrc);
+    if (invalid != ModeLimits::STAGED) {
+        lineField = invalid;
+        rejectLine();
+        return;
+    }
+    
+    arinc.sendLog(LogId::CMD_LIMITS, limitsCrc);
+}
+
+void applyLimits() {
+    // Copies dérivées relues une fois par échange, jamais pendant un tick
+    powerCalc.reloadLimits();
+    controller.reloadLimits();
+    
+    // Consigne re-contrainte aux nouvelles bornes du mode
+    uint16_t requested = powerState.getTotalPower();
+    powerState.setTotalPower(requested);
+    traceSetpoint(requested);
+    
+    arinc.sendLog(LogId::LIMITS_APPLIED, ModeLimits::getGeneration());
+}
+
+// ============================================================================
+// VITESSE SÉRIE
+// ============================================================================
+
+void feedLinkValue(uint32_t value) {
+    // 1 champ: vitesse proposée ; 2 champs: ping (nonce, CRC)
+    if (lineField >= 2U) {
+        rejectLine();
+        return;
+    }
+    
+    linkFields[lineField] = value;
+    lineField++;
+}
+
+void finishLinkInput() {
+    // 'b' seul: vitesse active et compteurs
+    if (lineField == 0U) {
+        arinc.sendLinkRate(linkRate);
+        return;
+    }
+    
+    if (lineField == 1U) {
+        if (!linkRate.propose(linkFields[0], millis())) {
+            rejectLine();
+            return;
+        }
+        
+        // Accord émis (et vidé) à l'ancienne vitesse, puis bascule
+        arinc.sendLog(LogId::LINK_ACK, linkFields[0], LINK_CONFIRM_TIMEOUT_MS);
+        link.setBaudrate(linkFields[0]);
+        return;
+    }
+    
+    const LinkRate::State before = linkRate.getState();
+    if (!linkRate.confirm(linkFields[0], linkFields[1], millis())) {
+        // Premier ping corrompu: la vitesse ne tient pas. Après le PONG, le
+        // PC peut renvoyer son ping jusqu'au délai (repli dans loop())
+        if (before == LinkRate::State::CONFIRMING) {
+            fallBackLink();
+        } else {
+            rejectLine();
+        }
+        return;
+    }
+    
+    // Second ping: le PC a reçu le PONG, les deux côtés restent à cette vitesse
+    if (before == LinkRate::State::VERIFYING) {
+        arinc.sendLog(LogId::LINK_CONFIRMED, linkRate.getBaudrate());
+        return;
+    }
+    
+    arinc.sendLog(
+        LogId::LINK_PONG,
+        linkRate.getBaudrate(),
+        linkFields[0],
+        LinkRate::pongCrc(linkFields[0], linkRate.getBaudrate())
+    );
+}
+
+void fallBackLink() {
+    const uint32_t failed = linkRate.getBaudrate();
+    
+    // Les deux côtés reviennent à la dernière vitesse confirmée
+    link.setBaudrate(linkRate.fallBack());
+    arinc.sendLog(LogId::LINK_FALLBACK, failed, linkRate.getBaudrate());
+}
+
 // ============================================================================
 // AFFICHAGE
 // ============================================================================
@@ -238,40 +814,272 @@ void updateDisplay() {
 }
 
 void sendCurrentStatus() {
-    // Calcul distribution actuelle
-    PowerDistribution::PowerOutput output = powerCalc.calculate(
-        flightMode.getMode(),
-        flightMode.getTotalPower()
-    );
-    
-    // Envoi status formaté
-    arinc.sendFullStatus(
-        flightMode.getMode(),
-        output.total,
-        output.electric,
-        output.thermal
-    );
+    // Distribution actuelle (recalculée seulement si mode/consigne/profils ont changé)
+    arinc.sendFullStatus(powerState.snapshot());
 }
 
 void sendFullDashboard() {
-    // Calcul distribution actuelle
-    PowerDistribution::PowerOutput output = powerCalc.calculate(
-        flightMode.getMode(),
-        flightMode.getTotalPower()
+    // Envoi dashboard complet avec barres (longueurs mémorisées)
+    arinc.sendDashboard(powerState.snapshot());
+}
+
+void sendARINCData() {
+    // Transmission ARINC périodique (commande 'a'): commandes moteurs
+    if (!arincStreaming) {
+        return;
+    }
+    
+    // Derniers messages du bus (versions intermédiaires sautées: 50 ms / 20 ms)
+    arincCommandFeed.poll();
+    arincBatteryFeed.poll();
+    const PowerDistribution::PowerOutput& command = arincCommandFeed.get().command;
+    const TopicBus::BatteryMessage& cell = arincBatteryFeed.get();
+    
+    arinc.sendTotalPower(command.total);
+    arinc.sendElectricPower(command.electric);
+    arinc.sendThermalPower(command.thermal);
+    arinc.sendBattery(cell.soc, cell.boostTime);
+    
+    // Label FLIGHT_MODE au changement de mode seulement (commande ou programme de vol)
+    const uint8_t mode = static_cast<uint8_t>(powerState.getMode());
+    if (mode != arincMode) {
+        arincMode = mode;
+        arinc.sendFlightMode(powerState.getMode());
+    }
+    
+    // Mot d'état système à cadence lente
+    unsigned long now = millis();
+    if (now - lastStatusTime >= ARINC_STATUS_INTERVAL) {
+        lastStatusTime = now;
+        arinc.sendSystemStatus(Metrics::packStatus());
+    }
+}
+
+void controlTick() {
+    // Limites: table validée publiée entre deux ticks, jamais pendant
+    if (ModeLimits::commit()) {
+        applyLimits();
+    }
+    
+    // Programme de vol: curseur O(1), consigne appliquée au changement d'étape
+    if (schedule.tick()) {
+        applyScheduleEntry();
+    }
+    
+    controller.tick(powerState.getMode(), powerState.getTotalPower());
+    // Plafond thermique du mode actif (mélangé en fondu), relu après limites et changement de mode
+    powerLoop.setLimit(PowerAllocator::Source::THERMAL, controller.getMax(PowerAllocator::Source::THERMAL));
+    powerLoop.tick(controller.getCommand());
+    
+    // Sortie du tick écrite en place sur le bus (abonnés: flux ARINC, statistiques)
+    TopicBus::CommandMessage& output = TopicBus::claim<TopicBus::Topic::COMMAND>();
+    output.command = powerLoop.getCommand();
+    output.mode = powerState.getMode();
+    // Déficit: la répartition (batterie, plafonds) ne couvre pas la demande
+    output.deficit = controller.getTarget().total < powerState.getTotalPower();
+    Hal::writePower(static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC), output.command.electric);
+    Hal::writePower(static_cast<uint8_t>(PowerAllocator::Source::THERMAL), output.command.thermal);
+    TopicBus::publish<TopicBus::Topic::COMMAND>();
+    
+    battery.tick(output.command.electric);
+    applyBatteryLimit();
+    
+    TopicBus::BatteryMessage& cell = TopicBus::claim<TopicBus::Topic::BATTERY>();
+    cell.soc = battery.getSoc();
+    cell.boostTime = battery.getBoostTime();
+    TopicBus::publish<TopicBus::Topic::BATTERY>();
+}
+
+void recordUsage() {
+    // Abonné du bus, appelé après chaque tick (rattrapage compris): une entrée par tick
+    if (usageFeed.poll() != 0U) {
+        const TopicBus::CommandMessage& output = usageFeed.get();
+        usage.record(output.mode, output.command, output.deficit);
+    }
+}
+
+bool readPowerSensor(PowerAllocator::Source source, uint16_t* power) {
+    // Capteurs via la HAL (aucun sur cible pour l'instant: boucle ouverte)
+    return Hal::readPower(static_cast<uint8_t>(source), power);
+}
+
+void applyBatteryLimit() {
+    // Plafond électrique effectif du tick suivant
+    const uint16_t limit = battery.getPowerLimit();
+    powerCalc.setElectricLimit(limit);
+    controller.setElectricLimit(limit);
+    powerLoop.setLimit(PowerAllocator::Source::ELECTRIC, limit);
+}
+
+// ============================================================================
+// PROGRAMME DE VOL
+// ============================================================================
+
+void applyScheduleEntry() {
+    if (!schedule.isPlaying()) {
+        // Fin: la dernière consigne reste, répartition du mode
+        controller.setElectricOverride(PowerController::ELECTRIC_AUTO);
+        arinc.sendLog(LogId::SCHEDULE_DONE);
+        return;
+    }
+    
+    const SchedulePlayer::Entry& entry = schedule.getEntry();
+    
+    if (schedule.getMode() != powerState.getMode()) {
+        changeMode(schedule.getMode());
+    }
+    powerState.setTotalPower(entry.total);
+    traceSetpoint(entry.total);
+    controller.setElectricOverride(
+        (entry.electric == SchedulePlayer::NO_OVERRIDE) ? PowerController::ELECTRIC_AUTO : entry.electric
     );
     
-    // Envoi dashboard complet avec barres
-    arinc.sendDashboard(
-        flightMode.getMode(),
-        output.total,
-        output.electric,
-        output.thermal
+    arinc.sendLog(
+        LogId::SCHEDULE_STEP,
+        schedule.getIndex() + 1U,
+        schedule.getCount(),
+        schedule.getMode(),
+        entry.total
     );
 }
 
-void sendARINCData() {
-    // Transmission ARINC périodique (silencieuse)
-    // Peut être activée pour monitoring temps réel
+void suspendSchedule() {
+    // Toute commande opérateur reprend la main sur le programme
+    if (schedule.suspend()) {
+        controller.setElectricOverride(PowerController::ELECTRIC_AUTO);
+        arinc.sendLog(LogId::SCHEDULE_SUSPENDED, schedule.getIndex() + 1U);
+    }
+}
+
+// ============================================================================
+// AFFICHAGE DE DÉMARRAGE
+// ============================================================================
+
+void pumpBootOutput() {
+    // Une unité d'affichage par passage: la boucle reste réactive.
+    // Texte UI perdu si la file déborde: on attend qu'elle soit vide
+    if (link.availableForWrite() < static_cast<int>(OUTPUT_UI_BUFFER)) {
+        return;
+    }
+    
+    switch (bootStage) {
+        case BOOT_BANNER:
+            if (!arinc.sendSystemBannerLine(bootLine++)) {
+                bootStage = BOOT_TRACE;
+                bootLine = 0U;
+            }
+            break;
+        
+        case BOOT_TRACE:
+            // Vidange automatique après reset watchdog
+            if (traceRecovered) {
+                arinc.sendLog(LogId::WARN_WATCHDOG_RESET);
+                arinc.sendTrace(blackBox);
+            }
+            if (!journal.isAvailable()) {
+                arinc.sendLog(LogId::WARN_JOURNAL_UNAVAILABLE);
+            } else if (!journal.isCalibrationPersistent()) {
+                arinc.sendLog(LogId::WARN_CALIBRATION_VOLATILE);
+            }
+            if (schedule.getCount() == 0U) {
+                arinc.sendLog(LogId::WARN_SCHEDULE_REJECTED);
+            }
+            if (stateRestored) {
+                arinc.sendLog(
+                    LogId::JOURNAL_RESTORED,
+                    powerState.getMode(),
+                    powerState.getTotalPower(),
+                    journal.getStateSequence()
+                );
+            }
+            bootStage = BOOT_STATUS;
+            break;
+        
+        case BOOT_STATUS:
+            sendCurrentStatus();
+            bootStage = BOOT_HELP;
+            break;
+        
+        case BOOT_HELP:
+            if (bootLine < HELP_LINE_COUNT) {
+                link.println(HELP_TEXT[bootLine++]);
+            } else {
+                bootStage = BOOT_READY;
+            }
+            break;
+        
+        case BOOT_READY:
+            arinc.sendLog(LogId::SYSTEM_READY);
+            arinc.sendLog(LogId::SYSTEM_BOOT_TIME, bootOutputUs);
+            bootStage = BOOT_DONE;
+            break;
+        
+        case BOOT_DONE:
+        default:
+            break;
+    }
+}
+
+// ============================================================================
+// ÉTAT PERSISTANT
+// ============================================================================
+
+void restoreJournal(bool restoreUsage) {
+    if (!journal.begin()) {
+        return;
+    }
+    
+    // Après reset à chaud, les statistiques en RAM sont plus récentes
+    if (restoreUsage) {
+        journal.restoreUsage(usage);
+    }
+    journal.restoreCalibration(electricCurve);
+    journal.restoreCalibration(thermalCurve);
+    
+    StateJournal::State state;
+    if (journal.restoreState(&state)) {
+        powerState.setMode(static_cast<PowerDistribution::FlightMode>(state.mode));
+        powerState.setTotalPower(state.power);
+        controller.setCompensation((state.flags & StateJournal::FLAG_COMPENSATION) != 0U);
+        stateRestored = true;
+    }
+}
+
+StateJournal::State currentState() {
+    StateJournal::State state;
+    state.mode = static_cast<uint8_t>(powerState.getMode());
+    state.flags = controller.isCompensating() ? StateJournal::FLAG_COMPENSATION : 0U;
+    state.power = powerState.getTotalPower();
+    return state;
+}
+
+void persistState(unsigned long currentTime) {
+    bool written = false;
+    StateJournal::State state = currentState();
+    
+    // Rafales de commandes ('+' répétés, programme) regroupées en un enregistrement
+    if (state != pendingState) {
+        pendingState = state;
+        stateChangeTime = currentTime;
+    } else if (currentTime - stateChangeTime >= JOURNAL_STATE_SETTLE_MS) {
+        written = journal.saveState(state);
+    }
+    
+    if (currentTime - lastUsageSaveTime >= JOURNAL_USAGE_INTERVAL_MS) {
+        lastUsageSaveTime = currentTime;
+        written = journal.saveUsage(usage) || written;
+    }
+    
+    if (written) {
+        commitJournal();
+    }
+}
+
+void commitJournal() {
+    // Validation bloquante sur STM32 (effacement de page): watchdog rechargé avant
+    Hal::watchdogKick();
+    journal.commit();
+    Metrics::add(Metrics::Id::JOURNAL_COMMITS);
 }
 
 // ============================================================================
@@ -279,34 +1087,152 @@ void sendARINCData() {
 // ============================================================================
 
 void printHelp() {
-    Serial.println(F(""));
-    Serial.println(F("╔════════════════════════════════════════════════════════════════╗"));
-    Serial.println(F("║                      COMMANDES DISPONIBLES                     ║"));
-    Serial.println(F("╠════════════════════════════════════════════════════════════════╣"));
-    Serial.println(F("║  MODES DE VOL:                                                 ║"));
-    Serial.println(F("║    d - Mode DÉCOLLAGE (Electric 0-1000, Thermal 0-2250)       ║"));
-    Serial.println(F("║    n - Mode NORMAL (Thermal only 0-2750)                       ║"));
-    Serial.println(F("║    u - Mode URGENCE (Electric 0-1000, Thermal 0-2750)         ║"));
-    Serial.println(F("║                                                                ║"));
-    Serial.println(F("║  CONTRÔLE PUISSANCE:                                           ║"));
-    Serial.println(F("║    + - Augmenter puissance (+10 Cv)                            ║"));
-    Serial.println(F("║    - - Diminuer puissance (-10 Cv)                             ║"));
-    Serial.println(F("║    <nombre> - Définir puissance exacte (ex: 1500)              ║"));
-    Serial.println(F("║                                                                ║"));
-    Serial.println(F("║  SYSTÈME:                                                      ║"));
-    Serial.println(F("║    s - Afficher status complet + dashboard                     ║"));
-    Serial.println(F("║    h - Afficher cette aide                                     ║"));
-    Serial.println(F("║    r - Reset système                                           ║"));
-    Serial.println(F("╚════════════════════════════════════════════════════════════════╝"));
-    Serial.println(F(""));
+    for (uint8_t line = 0U; line < HELP_LINE_COUNT; line++) {
+        link.println(HELP_TEXT[line]);
+    }
 }
 
 void resetSystem() {
-    // Reset au mode DÉCOLLAGE
-    flightMode.setMode(PowerDistribution::FlightMode::DECOLLAGE);
-    flightMode.setTotalPower(DecollageConfig::INITIAL_POWER);
+    // Reset au mode DÉCOLLAGE, programme de vol arrêté
+    schedule.stop();
+    controller.setElectricOverride(PowerController::ELECTRIC_AUTO);
+    uint16_t initialPower = ModeLimits::of(PowerDistribution::FlightMode::DECOLLAGE).initialPower;
+    changeMode(PowerDistribution::FlightMode::DECOLLAGE);
+    powerState.setTotalPower(initialPower);
+    traceSetpoint(initialPower);
+    controller.reset(powerState.getMode(), powerState.getTotalPower());
     
-    Serial.println(F("[SYSTEM] Reset complet - Mode DÉCOLLAGE - 50 Cv"));
+    arinc.sendLog(
+        LogId::SYSTEM_RESET_DONE,
+        PowerDistribution::FlightMode::DECOLLAGE,
+        initialPower
+    );
     
     sendCurrentStatus();
 }
+
+// ============================================================================
+// BOÎTE NOIRE
+// ============================================================================
+
+void changeMode(PowerDistribution::FlightMode newMode) {
+    PowerDistribution::FlightMode previousMode = powerState.getMode();
+    uint16_t requested = powerState.getTotalPower();
+    
+    powerState.setMode(newMode);
+    
+    blackBox.record(
+        TraceBuffer::Event::MODE_CHANGE,
+        static_cast<uint16_t>(previousMode),
+        static_cast<uint16_t>(newMode)
+    );
+    
+    // Le re-clamp du nouveau mode peut saturer la consigne
+    traceSetpoint(requested);
+}
+
+void traceSetpoint(uint32_t requested) {
+    const PowerState::Snapshot& state = powerState.snapshot();
+    const PowerDistribution::PowerOutput& output = state.output;
+    
+    // Répartition inchangée ('+' en butée, même valeur): pas de doublon
+    if (state.version != tracedVersion) {
+        tracedVersion = state.version;
+        blackBox.record(TraceBuffer::Event::SETPOINT, output.electric, output.thermal);
+    }
+    
+    // Demande au-delà du plafond thermique du mode
+    if (requested > output.total) {
+        uint16_t clipped = (requested > 0xFFFFU) ? 0xFFFFU : static_cast<uint16_t>(requested);
+        blackBox.record(TraceBuffer::Event::SATURATION, clipped, output.thermal);
+        usage.recordCapped(powerState.getMode());
+    }
+}
+
+void updateLoopMetrics(unsigned long currentTime, uint32_t loopStartUs) {
+    Metrics::peak(Metrics::Id::LOOP_MAX_US, Hal::micros() - loopStartUs);
+    
+    const uint16_t txQueue = link.getTxQueue();
+    txQueuePeak = (txQueue > txQueuePeak) ? txQueue : txQueuePeak;
+    loopCount++;
+    
+    // Publication par fenêtre (jauges)
+    unsigned long elapsed = currentTime - lastMetricsTime;
+    if (elapsed >= METRICS_WINDOW_MS) {
+        Metrics::set(Metrics::Id::LOOP_RATE, static_cast<uint32_t>((static_cast<uint64_t>(loopCount) * 1000U) / elapsed));
+        Metrics::set(Metrics::Id::TX_QUEUE, txQueuePeak);
+        
+        // Charge CPU: part de la fenêtre passée hors veille (‰)
+        const uint64_t windowUs = static_cast<uint64_t>(elapsed) * 1000U;
+        const uint64_t busyUs = (windowUs > idleTimeUs) ? (windowUs - idleTimeUs) : 0U;
+        Metrics::set(Metrics::Id::DUTY_CYCLE, static_cast<uint32_t>((busyUs * 1000U) / windowUs));
+        
+        lastMetricsTime = currentTime;
+        loopCount = 0U;
+        txQueuePeak = 0U;
+        idleTimeUs = 0U;
+    }
+}
+
+unsigned long nextDeadline(unsigned long currentTime) {
+    // Tâches périodiques de loop(); journal et métriques sont évalués à
+    // chaque passage, donc au pire avec un tick de contrôle de retard
+    unsigned long wait = CONTROL_TICK_INTERVAL - (currentTime - lastControlTime);
+    
+    const unsigned long display = DISPLAY_UPDATE_INTERVAL - (currentTime - lastUpdateTime);
+    const unsigned long arincTx = ARINC_TX_INTERVAL - (currentTime - lastARINCTime);
+    const unsigned long led = LED_HEARTBEAT_INTERVAL - (currentTime % LED_HEARTBEAT_INTERVAL);
+    
+    wait = (display < wait) ? display : wait;
+    wait = (arincTx < wait) ? arincTx : wait;
+    wait = (led < wait) ? led : wait;
+    return wait;
+}
+
+void idleUntilNextDeadline(unsigned long currentTime, uint32_t loopStartUs) {
+    // currentTime est tronqué à la ms: l'échéance en µs tombe au plus tard
+    // à loopStartUs + attente, jamais avant celle vue par millis()
+    const uint32_t deadlineUs = loopStartUs + nextDeadline(currentTime) * 1000UL;
+    const uint32_t idleStart = Hal::micros();
+    uint32_t eventUs = deadlineUs;   // Référence de la latence de réveil
+    bool stamped = true;
+    
+    for (;;) {
+        link.pump();
+        if (Hal::takeWake(&eventUs)) {
+            break;  // Encodeur / boutons: front horodaté par l'interruption
+        }
+        if (link.available() > 0) {
+            stamped = false;  // UART: pas d'horodatage de réception
+            break;
+        }
+        const int32_t remaining = static_cast<int32_t>(deadlineUs - Hal::micros());
+        if (remaining <= 0) {
+            break;
+        }
+        // Sortie en file: réveil avant que l'UART ne se vide (l'interruption
+        // TX réveille déjà le cœur sur cible, borne utile sur host)
+        const uint32_t refill = link.getRefillUs();
+        Hal::sleep((refill != 0U && refill < static_cast<uint32_t>(remaining)) ? refill : static_cast<uint32_t>(remaining));
+    }
+    
+    // Latence: échéance (ou front d'entrée) → reprise de la boucle
+    const uint32_t now = Hal::micros();
+    if (stamped) {
+        Metrics::peak(Metrics::Id::WAKE_LATENCY_US, now - eventUs);
+    }
+    idleTimeUs += now - idleStart;
+}
+
+void checkTaskBudget(uint8_t taskId, uint32_t startUs) {
+    uint32_t elapsedUs = Hal::micros() - startUs;
+    
+    if (elapsedUs > TASK_OVERRUN_BUDGET_US) {
+        uint32_t elapsedMs = elapsedUs / 1000UL;
+        blackBox.record(
+            TraceBuffer::Event::OVERRUN,
+            taskId,
+            (elapsedMs > 0xFFFFUL) ? 0xFFFFU : static_cast<uint16_t>(elapsedMs)
+        );
+    }
+}
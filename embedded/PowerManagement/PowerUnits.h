@@ -0,0 +1,93 @@
+/**
+ * @file PowerUnits.h
+ * @brief Conversions de puissance en arithmétique entière (sans flottant)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Remplace cvToWatts()/wattsToCv() flottants sur les chemins périodiques:
+ * sur Cortex-M0/M3 (pas de FPU) chaque opération float est un appel
+ * soft-float. Ici tout est entier 32 bits ; les divisions par constante
+ * sont compilées en multiplication + décalage.
+ *
+ * Unités (entiers mis à l'échelle):
+ * - Cv      : uint16_t, 100 Cv = POWER_CONVERSION_FACTOR_W watts
+ * - Watts   : uint32_t, watt entier
+ * - Percent : uint16_t, pourcentage de la référence turbine
+ *             (100 % = POWER_CONVERSION_FACTOR_W, 80 % = TURBINE_CONSTANT_PERCENT)
+ *
+ * Arrondis:
+ * - Cv/% → W : au plus proche, demi vers le haut (exact si facteur multiple de 100)
+ * - W → Cv/% : troncature vers zéro (identique au cast de la version float),
+ *              saturé à 65535
+ *
+ * Vérification exhaustive et mesures: tools/power_units_check.cpp
+ */
+
+#ifndef POWER_UNITS_H
+#define POWER_UNITS_H
+
+#include <stdint.h>
+#include "config.h"
+
+namespace PowerUnits {
+
+    /** @brief Watts pour 100 Cv (ou 100 %) */
+    constexpr uint32_t FACTOR_W = POWER_CONVERSION_FACTOR_W;
+
+    /** @brief Plus petite puissance (W) dont la conversion sature à 65535 */
+    constexpr uint32_t SATURATION_W = (65536UL * FACTOR_W + 99U) / 100U;
+
+    /**
+     * @brief Cv → Watts (arrondi au plus proche)
+     *
+     * @param cv Puissance (Cv)
+     * @return Puissance (W)
+     */
+    constexpr uint32_t cvToWatts(uint16_t cv) {
+        return (static_cast<uint32_t>(cv) * FACTOR_W + 50U) / 100U;
+    }
+
+    /**
+     * @brief Watts → Cv (troncature, saturé)
+     *
+     * @param watts Puissance (W)
+     * @return Puissance (Cv)
+     */
+    constexpr uint16_t wattsToCv(uint32_t watts) {
+        return (watts >= SATURATION_W)
+            ? 0xFFFFU
+            : static_cast<uint16_t>((watts * 100U) / FACTOR_W);
+    }
+
+    /**
+     * @brief Pourcentage turbine → Watts (arrondi au plus proche)
+     *
+     * @param percent Pourcentage de la référence turbine
+     * @return Puissance (W)
+     */
+    constexpr uint32_t percentToWatts(uint16_t percent) {
+        return cvToWatts(percent);
+    }
+
+    /**
+     * @brief Watts → pourcentage turbine (troncature, saturé)
+     *
+     * @param watts Puissance (W)
+     * @return Pourcentage de la référence turbine
+     */
+    constexpr uint16_t wattsToPercent(uint32_t watts) {
+        return wattsToCv(watts);
+    }
+
+    /** @brief Puissance constante turbine (W) */
+    constexpr uint32_t TURBINE_CONSTANT_W = percentToWatts(TURBINE_CONSTANT_PERCENT);
+
+    static_assert((FACTOR_W % 100U) == 0U,
+                  "POWER_CONVERSION_FACTOR_W multiple de 100: conversion Cv → W exacte");
+    static_assert(FACTOR_W == static_cast<uint32_t>(POWER_CONVERSION_FACTOR),
+                  "POWER_CONVERSION_FACTOR_W et POWER_CONVERSION_FACTOR divergent");
+    static_assert(TURBINE_CONSTANT_W == static_cast<uint32_t>(TURBINE_CONSTANT_WATTS),
+                  "TURBINE_CONSTANT_WATTS incohérent avec TURBINE_CONSTANT_PERCENT");
+}
+
+#endif // POWER_UNITS_H
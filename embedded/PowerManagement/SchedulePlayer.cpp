@@ -0,0 +1,148 @@
+/**
+ * @file SchedulePlayer.cpp
+ * @brief Implémentation de la lecture du programme de vol
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "SchedulePlayer.h"
+#include "ModeLimits.h"
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+SchedulePlayer::SchedulePlayer(uint16_t tickMs)
+    : entries_(nullptr)
+    , count_(0U)
+    , index_(0U)
+    , remaining_(0U)
+    , tickMs_(tickMs)
+    , state_(State::IDLE)
+{
+}
+
+// ============================================================================
+// PROGRAMME
+// ============================================================================
+
+bool SchedulePlayer::load(const Entry* entries, uint16_t count) {
+    if ((entries == nullptr) || (count == 0U)) {
+        return false;
+    }
+
+    // Validation unique au chargement: tick() ne revérifie rien
+    for (uint16_t i = 0U; i < count; i++) {
+        if ((entries[i].duration == 0U) || (entries[i].mode >= PowerDistribution::MODE_COUNT)) {
+            return false;
+        }
+
+        // Part imposée au-delà du plafond du mode: écrêtée en vol, programme inexécutable
+        const PowerDistribution::FlightMode mode = static_cast<PowerDistribution::FlightMode>(entries[i].mode);
+        if ((entries[i].electric != NO_OVERRIDE) && (entries[i].electric > ModeLimits::of(mode).electricMax)) {
+            return false;
+        }
+    }
+
+    entries_ = entries;
+    count_ = count;
+    index_ = 0U;
+    remaining_ = 0U;
+    state_ = State::IDLE;
+    return true;
+}
+
+// ============================================================================
+// COMMANDES
+// ============================================================================
+
+bool SchedulePlayer::start() {
+    if (count_ == 0U) {
+        return false;
+    }
+
+    index_ = 0U;
+    remaining_ = static_cast<uint32_t>(entries_[0].duration) * 1000UL;
+    state_ = State::PLAYING;
+    return true;
+}
+
+void SchedulePlayer::stop() {
+    state_ = State::IDLE;
+}
+
+bool SchedulePlayer::suspend() {
+    if (state_ != State::PLAYING) {
+        return false;
+    }
+
+    state_ = State::OVERRIDDEN;
+    return true;
+}
+
+bool SchedulePlayer::resume() {
+    if (state_ != State::OVERRIDDEN) {
+        return false;
+    }
+
+    state_ = State::PLAYING;
+    return true;
+}
+
+// ============================================================================
+// AVANCE PAR TICK
+// ============================================================================
+
+bool SchedulePlayer::tick() {
+    if (state_ != State::PLAYING) {
+        return false;
+    }
+
+    if (remaining_ > tickMs_) {
+        remaining_ -= tickMs_;
+        return false;
+    }
+
+    // Étape suivante (durée ≥ 1 s > période: une seule étape par tick)
+    if (++index_ >= count_) {
+        index_ = static_cast<uint16_t>(count_ - 1U);
+        remaining_ = 0U;
+        state_ = State::DONE;
+        return true;
+    }
+
+    remaining_ = static_cast<uint32_t>(entries_[index_].duration) * 1000UL - (tickMs_ - remaining_);
+    return true;
+}
+
+// ============================================================================
+// ACCESSEURS
+// ============================================================================
+
+const SchedulePlayer::Entry& SchedulePlayer::getEntry() const {
+    return entries_[index_];
+}
+
+PowerDistribution::FlightMode SchedulePlayer::getMode() const {
+    return static_cast<PowerDistribution::FlightMode>(entries_[index_].mode);
+}
+
+uint16_t SchedulePlayer::getIndex() const {
+    return index_;
+}
+
+uint16_t SchedulePlayer::getCount() const {
+    return count_;
+}
+
+uint32_t SchedulePlayer::getRemaining() const {
+    return remaining_;
+}
+
+SchedulePlayer::State SchedulePlayer::getState() const {
+    return state_;
+}
+
+bool SchedulePlayer::isPlaying() const {
+    return state_ == State::PLAYING;
+}
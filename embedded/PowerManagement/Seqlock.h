@@ -0,0 +1,124 @@
+/**
+ * @file Seqlock.h
+ * @brief Instantané partagé sans verrou (un écrivain, lecteurs sans masquage IRQ)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * L'écrivain rend le compteur de séquence impair, recopie la valeur puis
+ * le rend pair ; un lecteur recommence si la séquence était impaire ou a
+ * changé pendant sa copie. Les mots sont copiés par accès atomiques
+ * relâchés (pas de course au sens du modèle mémoire), bornés par des
+ * barrières acquire/release.
+ *
+ * Règles:
+ * - Un seul écrivain à la fois (contextes écrivains qui ne se préemptent pas)
+ * - read() depuis un contexte qui ne préempte pas l'écrivain (loop() lisant
+ *   ce qu'une interruption écrit, autre thread host) ; depuis une
+ *   interruption plus prioritaire que l'écrivain, tryRead() seulement
+ * - T trivialement copiable, taille multiple de 4 octets
+ */
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stdint.h>
+#include <string.h>
+
+template<typename T>
+class Seqlock {
+public:
+    /**
+     * @brief Constructeur (valeur nulle, séquence 0)
+     */
+    Seqlock()
+        : sequence_(0U)
+        , words_()
+    {
+    }
+
+    /**
+     * @brief Publie une nouvelle valeur (écrivain unique)
+     *
+     * Ne bloque jamais: utilisable depuis une interruption.
+     *
+     * @param value Valeur à publier
+     */
+    void write(const T& value) {
+        uint32_t words[WORDS];
+        memcpy(words, &value, sizeof(T));
+
+        const uint32_t sequence = __atomic_load_n(&sequence_, __ATOMIC_RELAXED);
+        __atomic_store_n(&sequence_, sequence + 1U, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+
+        for (uint8_t i = 0U; i < WORDS; i++) {
+            __atomic_store_n(&words_[i], words[i], __ATOMIC_RELAXED);
+        }
+
+        __atomic_store_n(&sequence_, sequence + 2U, __ATOMIC_RELEASE);
+    }
+
+    /**
+     * @brief Lit une valeur cohérente (recommence si une écriture l'a croisée)
+     *
+     * @param retries Nombre de reprises, écrit si non nul (diagnostic)
+     * @return Dernière valeur publiée
+     */
+    T read(uint32_t* retries = nullptr) const {
+        T value;
+        uint32_t count = 0U;
+
+        while (!tryRead(&value)) {
+            count++;
+        }
+        if (retries != nullptr) {
+            *retries = count;
+        }
+        return value;
+    }
+
+    /**
+     * @brief Tentative de lecture unique (jamais d'attente)
+     *
+     * @param value Destination, écrite seulement si la lecture est cohérente
+     * @return false si une écriture était en cours ou a croisé la copie
+     */
+    bool tryRead(T* value) const {
+        uint32_t words[WORDS];
+
+        const uint32_t before = __atomic_load_n(&sequence_, __ATOMIC_ACQUIRE);
+        if ((before & 1U) != 0U) {
+            return false;
+        }
+
+        for (uint8_t i = 0U; i < WORDS; i++) {
+            words[i] = __atomic_load_n(&words_[i], __ATOMIC_RELAXED);
+        }
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&sequence_, __ATOMIC_RELAXED) != before) {
+            return false;
+        }
+
+        memcpy(value, words, sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief Nombre de valeurs publiées
+     */
+    uint32_t getWrites() const {
+        return __atomic_load_n(&sequence_, __ATOMIC_ACQUIRE) / 2U;
+    }
+
+private:
+    static_assert((sizeof(T) % 4U) == 0U, "Seqlock: taille multiple de 4 octets");
+
+    /** @brief Mots de 32 bits par valeur */
+    static constexpr uint8_t WORDS = sizeof(T) / 4U;
+
+    uint32_t sequence_;       ///< Impair pendant une écriture
+    uint32_t words_[WORDS];   ///< Valeur publiée
+};
+
+#endif // SEQLOCK_H
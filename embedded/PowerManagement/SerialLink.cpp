@@ -0,0 +1,423 @@
+/**
+ * @file SerialLink.cpp
+ * @brief Implémentation du port série instrumenté
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "SerialLink.h"
+#include "Metrics.h"
+#include "Hal.h"
+#include <string.h>
+
+// Taille du tampon d'émission du cœur STM32 (64 par défaut)
+#ifndef SERIAL_TX_BUFFER_SIZE
+#define SERIAL_TX_BUFFER_SIZE 64
+#endif
+
+static_assert((OUTPUT_SAFETY_BUFFER & (OUTPUT_SAFETY_BUFFER - 1U)) == 0U, "OUTPUT_SAFETY_BUFFER: puissance de 2");
+static_assert((OUTPUT_UI_BUFFER & (OUTPUT_UI_BUFFER - 1U)) == 0U, "OUTPUT_UI_BUFFER: puissance de 2");
+static_assert(OUTPUT_UI_BUFFER <= 32768U, "OUTPUT_UI_BUFFER: index 16 bits");
+static_assert(OUTPUT_TELEMETRY_LINE <= 255U, "OUTPUT_TELEMETRY_LINE: longueur 8 bits");
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+SerialLink::SerialLink(HardwareSerial& port)
+    : port_(port)
+    , baudrate_(SERIAL_BAUDRATE)
+    , safety_()
+    , safetyHead_(0U)
+    , safetyTail_(0U)
+    , ui_()
+    , uiHead_(0U)
+    , uiTail_(0U)
+    , uiLineStart_(0U)
+    , uiDropping_(false)
+    , uiLineCut_(false)
+    , telemetry_()
+    , inFlight_()
+    , inFlightLength_(0U)
+    , inFlightSent_(0U)
+    , telemetryOrder_(0U)
+    , class_(OutputClass::UI)
+    , key_(0U)
+    , txClass_(NO_CLASS)
+    , counters_()
+{
+}
+
+void SerialLink::begin(uint32_t baudrate) {
+    port_.begin(baudrate);
+    baudrate_ = baudrate;
+    Hal::serialRate(baudrate);
+}
+
+void SerialLink::setBaudrate(uint32_t baudrate) {
+    // Tout ce qui est en file part à l'ancienne vitesse
+    flush();
+    port_.end();
+    begin(baudrate);
+}
+
+uint32_t SerialLink::getBaudrate() const {
+    return baudrate_;
+}
+
+// ============================================================================
+// ÉMISSION
+// ============================================================================
+
+size_t SerialLink::write(uint8_t byte) {
+    return queue(byte);
+}
+
+size_t SerialLink::write(const uint8_t* buffer, size_t size) {
+    size_t accepted = 0U;
+
+    for (size_t i = 0U; i < size; i++) {
+        accepted += queue(buffer[i]);
+    }
+    return accepted;
+}
+
+int SerialLink::availableForWrite() {
+    switch (class_) {
+        case OutputClass::SAFETY:
+            return OUTPUT_SAFETY_BUFFER - static_cast<uint16_t>(safetyHead_ - safetyTail_);
+
+        case OutputClass::TELEMETRY:
+            return OUTPUT_TELEMETRY_LINE - telemetry_[key_].length;
+
+        case OutputClass::UI:
+        default:
+            return OUTPUT_UI_BUFFER - static_cast<uint16_t>(uiHead_ - uiTail_);
+    }
+}
+
+void SerialLink::flush() {
+    for (;;) {
+        pump();
+        if (txClass_ == NO_CLASS) {
+            txClass_ = nextClass();
+            if (txClass_ == NO_CLASS) {
+                break;
+            }
+        }
+    }
+    port_.flush();
+}
+
+void SerialLink::beginMessage(OutputClass outputClass, uint8_t key) {
+    class_ = outputClass;
+    key_ = key;
+
+    if (outputClass != OutputClass::TELEMETRY) {
+        return;
+    }
+    if (key >= OUTPUT_TELEMETRY_SLOTS) {
+        class_ = OutputClass::UI;
+        return;
+    }
+
+    // Valeur précédente pas encore partie: périmée, remplacée
+    TelemetrySlot& slot = telemetry_[key];
+    if (slot.pending) {
+        slot.pending = false;
+        counters_[static_cast<uint8_t>(OutputClass::TELEMETRY)].replaced++;
+    }
+    slot.length = 0U;
+    slot.truncated = false;
+}
+
+void SerialLink::endMessage() {
+    ClassCounters& counters = counters_[static_cast<uint8_t>(class_)];
+
+    if (class_ == OutputClass::TELEMETRY) {
+        TelemetrySlot& slot = telemetry_[key_];
+
+        // Valeur tronquée: perdue plutôt qu'émise incomplète
+        if (slot.truncated) {
+            counters.dropped++;
+        } else {
+            slot.pending = true;
+            slot.order = telemetryOrder_++;
+            counters.messages++;
+        }
+
+        uint16_t used = static_cast<uint16_t>(inFlightLength_ - inFlightSent_);
+        for (uint8_t k = 0U; k < OUTPUT_TELEMETRY_SLOTS; k++) {
+            used += telemetry_[k].pending ? telemetry_[k].length : 0U;
+        }
+        trackPeak(OutputClass::TELEMETRY, used);
+    } else if (class_ == OutputClass::SAFETY) {
+        counters.messages++;
+    }
+
+    class_ = OutputClass::UI;
+}
+
+size_t SerialLink::queue(uint8_t byte) {
+    switch (class_) {
+        case OutputClass::SAFETY: {
+            // Jamais perdu: la file se vide vers l'UART pendant l'attente
+            if (static_cast<uint16_t>(safetyHead_ - safetyTail_) >= OUTPUT_SAFETY_BUFFER) {
+                counters_[static_cast<uint8_t>(OutputClass::SAFETY)].waits++;
+                do {
+                    pump();
+                } while (static_cast<uint16_t>(safetyHead_ - safetyTail_) >= OUTPUT_SAFETY_BUFFER);
+            }
+            safety_[safetyHead_++ & (OUTPUT_SAFETY_BUFFER - 1U)] = byte;
+            trackPeak(OutputClass::SAFETY, static_cast<uint16_t>(safetyHead_ - safetyTail_));
+            return 1U;
+        }
+
+        case OutputClass::TELEMETRY: {
+            TelemetrySlot& slot = telemetry_[key_];
+            if (slot.length < OUTPUT_TELEMETRY_LINE) {
+                slot.data[slot.length++] = byte;
+            } else {
+                slot.truncated = true;
+            }
+            return 1U;
+        }
+
+        case OutputClass::UI:
+        default:
+            break;
+    }
+
+    ClassCounters& counters = counters_[static_cast<uint8_t>(OutputClass::UI)];
+
+    if (static_cast<uint16_t>(uiHead_ - uiTail_) >= OUTPUT_UI_BUFFER) {
+        pump();
+    }
+
+    if (!uiDropping_ && static_cast<uint16_t>(uiHead_ - uiTail_) >= OUTPUT_UI_BUFFER) {
+        uiDropping_ = true;
+        counters.dropped++;
+        Metrics::add(Metrics::Id::FRAMES_DROPPED);
+
+        // Début de ligne encore en file: retiré, la ligne disparaît entière
+        if (static_cast<uint16_t>(uiLineStart_ - uiTail_) <= static_cast<uint16_t>(uiHead_ - uiTail_)) {
+            uiHead_ = uiLineStart_;
+            uiLineCut_ = false;
+        } else {
+            uiLineCut_ = true;
+        }
+    }
+
+    if (uiDropping_) {
+        if (byte != '\n') {
+            return 0U;
+        }
+        uiDropping_ = false;
+        uiLineStart_ = uiHead_;
+
+        // Ligne déjà partiellement émise: terminée pour ne pas la coller
+        // à la suivante (si la place manque, le '\n' est perdu aussi)
+        if (!uiLineCut_ || static_cast<uint16_t>(uiHead_ - uiTail_) >= OUTPUT_UI_BUFFER) {
+            return 0U;
+        }
+    } else if (byte == '\n') {
+        counters.messages++;
+    }
+
+    ui_[uiHead_++ & (OUTPUT_UI_BUFFER - 1U)] = byte;
+    if (byte == '\n') {
+        uiLineStart_ = uiHead_;
+    }
+    trackPeak(OutputClass::UI, static_cast<uint16_t>(uiHead_ - uiTail_));
+    return 1U;
+}
+
+void SerialLink::pump() {
+    const int free = port_.availableForWrite();
+    uint16_t room = Hal::serialRoom(static_cast<uint16_t>((free > 0) ? free : 0));
+
+    while (room > 0U) {
+        if (txClass_ == NO_CLASS) {
+            txClass_ = nextClass();
+            if (txClass_ == NO_CLASS) {
+                break;
+            }
+        }
+
+        // Une classe garde l'UART jusqu'à la fin de son message: pas
+        // d'entrelacement au milieu d'une ligne
+        uint16_t sent = 0U;
+        bool done = false;
+
+        switch (static_cast<OutputClass>(txClass_)) {
+            case OutputClass::SAFETY:
+                sent = drainRing(safety_, OUTPUT_SAFETY_BUFFER, safetyHead_, &safetyTail_, room, false);
+                done = (safetyHead_ == safetyTail_);
+                break;
+
+            case OutputClass::TELEMETRY: {
+                uint16_t length = static_cast<uint16_t>(inFlightLength_ - inFlightSent_);
+                length = (length < room) ? length : room;
+                sent = static_cast<uint16_t>(port_.write(&inFlight_[inFlightSent_], length));
+                inFlightSent_ = static_cast<uint8_t>(inFlightSent_ + sent);
+                done = (inFlightSent_ >= inFlightLength_);
+                break;
+            }
+
+            case OutputClass::UI:
+            default:
+                sent = drainRing(ui_, OUTPUT_UI_BUFFER, uiHead_, &uiTail_, room, true);
+                done = (uiHead_ == uiTail_)
+                    || (sent > 0U && ui_[(uiTail_ - 1U) & (OUTPUT_UI_BUFFER - 1U)] == '\n');
+                break;
+        }
+
+        counters_[txClass_].bytes += sent;
+        Metrics::add(Metrics::Id::BYTES_TX, sent);
+        Hal::serialSent(sent);
+
+        if (done) {
+            txClass_ = NO_CLASS;
+        }
+        if (sent == 0U) {
+            break;  // UART plein
+        }
+        room = static_cast<uint16_t>(room - sent);
+    }
+}
+
+void SerialLink::waitForUi(uint16_t bytes) {
+    bytes = (bytes < OUTPUT_UI_BUFFER) ? bytes : OUTPUT_UI_BUFFER;
+
+    while (static_cast<uint16_t>(OUTPUT_UI_BUFFER - static_cast<uint16_t>(uiHead_ - uiTail_)) < bytes) {
+        pump();
+    }
+}
+
+uint32_t SerialLink::getRefillUs() const {
+    if (!hasBacklog() || baudrate_ == 0U) {
+        return 0U;
+    }
+
+    // 10 bits par octet (start + 8 + stop)
+    const uint32_t bits = (SERIAL_TX_BUFFER_SIZE / 2U) * 10UL;
+    return static_cast<uint32_t>((static_cast<uint64_t>(bits) * 1000000UL) / baudrate_);
+}
+
+bool SerialLink::hasBacklog() const {
+    if (safetyHead_ != safetyTail_ || uiHead_ != uiTail_ || inFlightSent_ < inFlightLength_) {
+        return true;
+    }
+    for (uint8_t k = 0U; k < OUTPUT_TELEMETRY_SLOTS; k++) {
+        if (telemetry_[k].pending) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t SerialLink::nextClass() {
+    if (safetyHead_ != safetyTail_) {
+        return static_cast<uint8_t>(OutputClass::SAFETY);
+    }
+
+    // Valeur la plus ancienne d'abord (ordre de fermeture)
+    uint8_t oldest = NO_CLASS;
+    uint16_t oldestAge = 0U;
+    for (uint8_t k = 0U; k < OUTPUT_TELEMETRY_SLOTS; k++) {
+        const uint16_t age = static_cast<uint16_t>(telemetryOrder_ - telemetry_[k].order);
+        if (telemetry_[k].pending && (oldest == NO_CLASS || age > oldestAge)) {
+            oldest = k;
+            oldestAge = age;
+        }
+    }
+    if (oldest != NO_CLASS) {
+        TelemetrySlot& slot = telemetry_[oldest];
+        memcpy(inFlight_, slot.data, slot.length);
+        inFlightLength_ = slot.length;
+        inFlightSent_ = 0U;
+        slot.pending = false;
+        return static_cast<uint8_t>(OutputClass::TELEMETRY);
+    }
+
+    if (uiHead_ != uiTail_) {
+        return static_cast<uint8_t>(OutputClass::UI);
+    }
+    return NO_CLASS;
+}
+
+uint16_t SerialLink::drainRing(const uint8_t* ring, uint16_t size, uint16_t head, uint16_t* tail,
+                               uint16_t room, bool stopAtLine) {
+    uint16_t sent = 0U;
+
+    while (sent < room && *tail != head) {
+        // Segment contigu: jusqu'à la tête, la fin de l'anneau ou la place UART
+        const uint16_t index = *tail & (size - 1U);
+        uint16_t length = static_cast<uint16_t>(head - *tail);
+        length = (length < size - index) ? length : static_cast<uint16_t>(size - index);
+        length = (length < room - sent) ? length : static_cast<uint16_t>(room - sent);
+
+        bool lineEnd = false;
+        if (stopAtLine) {
+            const void* newline = memchr(&ring[index], '\n', length);
+            if (newline != nullptr) {
+                length = static_cast<uint16_t>(static_cast<const uint8_t*>(newline) - &ring[index] + 1);
+                lineEnd = true;
+            }
+        }
+
+        const uint16_t written = static_cast<uint16_t>(port_.write(&ring[index], length));
+        *tail = static_cast<uint16_t>(*tail + written);
+        sent = static_cast<uint16_t>(sent + written);
+
+        if (written < length || lineEnd) {
+            break;
+        }
+    }
+    return sent;
+}
+
+void SerialLink::trackPeak(OutputClass outputClass, uint16_t used) {
+    ClassCounters& counters = counters_[static_cast<uint8_t>(outputClass)];
+    counters.peak = (used > counters.peak) ? used : counters.peak;
+}
+
+const SerialLink::ClassCounters& SerialLink::getCounters(OutputClass outputClass) const {
+    return counters_[static_cast<uint8_t>(outputClass)];
+}
+
+uint16_t SerialLink::getTxQueue() {
+    // Tampon circulaire: capacité = taille - 1
+    const int free = port_.availableForWrite();
+    const int pending = (SERIAL_TX_BUFFER_SIZE - 1) - free;
+
+    uint32_t queued = static_cast<uint32_t>((pending > 0) ? pending : 0);
+    queued += static_cast<uint16_t>(safetyHead_ - safetyTail_);
+    queued += static_cast<uint16_t>(uiHead_ - uiTail_);
+    queued += static_cast<uint16_t>(inFlightLength_ - inFlightSent_);
+    for (uint8_t k = 0U; k < OUTPUT_TELEMETRY_SLOTS; k++) {
+        queued += telemetry_[k].pending ? telemetry_[k].length : 0U;
+    }
+    return static_cast<uint16_t>((queued < 0xFFFFU) ? queued : 0xFFFFU);
+}
+
+// ============================================================================
+// RÉCEPTION
+// ============================================================================
+
+int SerialLink::available() {
+    return port_.available();
+}
+
+int SerialLink::read() {
+    const int value = port_.read();
+
+    if (value >= 0) {
+        Metrics::add(Metrics::Id::BYTES_RX);
+    }
+    return value;
+}
+
+int SerialLink::peek() {
+    return port_.peek();
+}
@@ -0,0 +1,85 @@
+/**
+ * @file SetpointRamp.cpp
+ * @brief Implémentation du générateur de rampe
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "SetpointRamp.h"
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+SetpointRamp::SetpointRamp()
+    : currentQ16_(0U)
+    , upQ16_(0U)
+    , downQ16_(0U)
+    , target_(0U)
+{
+}
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+void SetpointRamp::setRates(uint16_t upPerSecond, uint16_t downPerSecond, uint16_t tickMs) {
+    upQ16_ = stepPerTick(upPerSecond, tickMs);
+    downQ16_ = stepPerTick(downPerSecond, tickMs);
+}
+
+void SetpointRamp::setTarget(uint16_t target) {
+    target_ = target;
+}
+
+void SetpointRamp::reset(uint16_t value) {
+    target_ = value;
+    currentQ16_ = static_cast<uint32_t>(value) << 16;
+}
+
+// ============================================================================
+// AVANCE PAR TICK
+// ============================================================================
+
+void SetpointRamp::tick() {
+    const uint32_t targetQ16 = static_cast<uint32_t>(target_) << 16;
+
+    if (currentQ16_ < targetQ16) {
+        const uint32_t gap = targetQ16 - currentQ16_;
+        currentQ16_ += ((upQ16_ == 0U) || (gap < upQ16_)) ? gap : upQ16_;
+    } else {
+        const uint32_t gap = currentQ16_ - targetQ16;
+        currentQ16_ -= ((downQ16_ == 0U) || (gap < downQ16_)) ? gap : downQ16_;
+    }
+}
+
+// ============================================================================
+// ACCESSEURS
+// ============================================================================
+
+uint16_t SetpointRamp::getTarget() const {
+    return target_;
+}
+
+uint16_t SetpointRamp::getCurrent() const {
+    // Arrondi au plus proche ; ne peut dépasser 65535 (current ≤ max(cible))
+    return static_cast<uint16_t>((currentQ16_ + 0x8000UL) >> 16);
+}
+
+bool SetpointRamp::isSettled() const {
+    return currentQ16_ == (static_cast<uint32_t>(target_) << 16);
+}
+
+// ============================================================================
+// UTILITAIRES
+// ============================================================================
+
+uint32_t SetpointRamp::stepPerTick(uint16_t perSecond, uint16_t tickMs) {
+    // (perSecond × tickMs / 1000) en Q16.16, sans dépassement 32 bits
+    const uint32_t perTick = static_cast<uint32_t>(perSecond) * tickMs;
+    const uint32_t whole = perTick / 1000U;
+    const uint32_t fraction = ((perTick % 1000U) << 16) / 1000U;
+
+    // Limite: 65535 Cv par tick (au-delà, équivalent à illimité)
+    return (whole > 0xFFFFU) ? 0U : ((whole << 16) + fraction);
+}
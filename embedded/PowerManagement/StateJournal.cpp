@@ -0,0 +1,436 @@
+/**
+ * @file StateJournal.cpp
+ * @brief Implémentation du journal d'état persistant
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "StateJournal.h"
+#include "Crc.h"
+#include "Hal.h"
+
+// ============================================================================
+// FORMAT
+// ============================================================================
+
+#if defined(ARDUINO_ARCH_STM32) || defined(__AVR__)
+#include <EEPROM.h>
+#endif
+
+namespace {
+    /**
+     * @brief En-tête d'enregistrement (couvert par le CRC)
+     */
+    struct Header {
+        uint16_t magic;     ///< RECORD_MAGIC
+        uint16_t size;      ///< Taille des données (octets)
+        uint32_t sequence;  ///< Séquence dans la zone, > 0
+    };
+
+    /**
+     * @brief Préfixe d'un enregistrement de calibration
+     */
+    struct CalibrationPrefix {
+        uint8_t shift;      ///< log2(pas)
+        uint8_t reserved;   ///< 0
+        uint16_t count;     ///< Points qui suivent, 0 = défaut flash
+    };
+
+    /**
+     * @brief Statistiques d'un mode sans l'histogramme par bande
+     *
+     * Les cumuls (temps, écrêtages, min/max/moyenne) passent les coupures ;
+     * l'histogramme repart de zéro à la mise sous tension.
+     */
+    struct UsageRecord {
+        uint32_t ticks;                                ///< UsageStats::Mode::ticks
+        uint32_t capped;                               ///< UsageStats::Mode::capped
+        uint32_t shortfall;                            ///< UsageStats::Mode::shortfall
+        uint16_t min[UsageStats::ENGINE_COUNT];        ///< UsageStats::Engine::min
+        uint16_t max[UsageStats::ENGINE_COUNT];        ///< UsageStats::Engine::max
+        uint64_t sum[UsageStats::ENGINE_COUNT];        ///< UsageStats::Engine::sum
+    };
+
+    /**
+     * @brief Géométrie d'une zone
+     */
+    struct Layout {
+        uint16_t capacity;  ///< Données max par emplacement (octets)
+        uint8_t slots;      ///< Emplacements
+        bool exact;         ///< Taille des données imposée (= capacity)
+        bool paged;         ///< Zone de pages flash (sinon EEPROM)
+    };
+
+    /** @brief Marqueur d'enregistrement ("VJ") */
+    constexpr uint16_t RECORD_MAGIC = 0x4A56U;
+
+    /** @brief En-tête + CRC */
+    constexpr uint16_t RECORD_OVERHEAD = sizeof(Header) + sizeof(uint32_t);
+
+    /** @brief Taille de lecture pour la vérification CRC (pile) */
+    constexpr uint16_t VERIFY_CHUNK = 32U;
+
+    constexpr uint16_t STATE_SIZE = sizeof(StateJournal::State);
+    constexpr uint16_t USAGE_SIZE = sizeof(UsageRecord) * PowerDistribution::MODE_COUNT;
+    constexpr uint16_t CALIBRATION_SIZE = sizeof(CalibrationPrefix) + (CALIBRATION_MAX_POINTS * sizeof(uint32_t));
+
+    /** @brief EEPROM occupée: anneau d'état puis statistiques */
+    constexpr uint32_t NV_REQUIRED = ((STATE_SIZE + RECORD_OVERHEAD) * JOURNAL_STATE_SLOTS)
+        + ((USAGE_SIZE + RECORD_OVERHEAD) * 2UL);
+
+    /** @brief Zones dans l'ordre de StateJournal::Zone */
+    const Layout LAYOUT[] = {
+        { STATE_SIZE, JOURNAL_STATE_SLOTS, true, false },
+        { USAGE_SIZE, 2U, true, false },
+        { CALIBRATION_SIZE, 2U, false, true },
+        { CALIBRATION_SIZE, 2U, false, true }
+    };
+
+    static_assert(JOURNAL_STATE_SLOTS >= 2U, "Au moins deux emplacements d'état");
+#if defined(E2END)
+    static_assert(NV_REQUIRED <= E2END + 1UL, "Journal plus grand que l'EEPROM de la cible");
+#endif
+    static_assert(NV_REQUIRED <= 1024UL, "Journal plus grand que l'EEPROM émulée du F103 (1 Ko)");
+    static_assert((sizeof(Header) % 2U) == 0U && (sizeof(CalibrationPrefix) % 2U) == 0U,
+                  "Parties d'enregistrement paires (programmation flash par demi-mots)");
+
+    uint32_t slotSize(uint8_t zone) {
+        return static_cast<uint32_t>(LAYOUT[zone].capacity) + RECORD_OVERHEAD;
+    }
+
+    void read(uint8_t zone, uint32_t offset, void* data, uint16_t size) {
+        if (LAYOUT[zone].paged) {
+            Hal::pageRead(offset, data, size);
+        } else {
+            Hal::nvRead(offset, data, size);
+        }
+    }
+
+    void write(uint8_t zone, uint32_t offset, const void* data, uint16_t size) {
+        if (LAYOUT[zone].paged) {
+            Hal::pageWrite(offset, data, size);
+        } else {
+            Hal::nvWrite(offset, data, size);
+        }
+    }
+
+    /**
+     * @brief Vérifie le CRC d'un enregistrement par morceaux (sans tampon complet)
+     */
+    bool verify(uint8_t zone, uint32_t offset, const Header& header) {
+        uint8_t chunk[VERIFY_CHUNK];
+        uint32_t crc = Crc::crc32(&header, sizeof(header));
+        uint32_t address = offset + sizeof(Header);
+        uint16_t remaining = header.size;
+
+        while (remaining > 0U) {
+            const uint16_t length = (remaining < VERIFY_CHUNK) ? remaining : VERIFY_CHUNK;
+            read(zone, address, chunk, length);
+            crc = Crc::crc32(chunk, length, crc);
+            address += length;
+            remaining = static_cast<uint16_t>(remaining - length);
+        }
+
+        uint32_t stored = 0UL;
+        read(zone, address, &stored, sizeof(stored));
+        return stored == crc;
+    }
+}
+
+// ============================================================================
+// CONSTRUCTEUR / OUVERTURE
+// ============================================================================
+
+StateJournal::StateJournal()
+    : available_(false)
+    , pageStride_(0UL)
+    , newest_()
+    , state_()
+{
+}
+
+bool StateJournal::begin() {
+    available_ = (Hal::nvBegin() >= requiredSize());
+    if (!available_) {
+        return false;
+    }
+
+    // Emplacements de calibration alignés sur les pages: effacés un par un
+    const uint32_t page = Hal::pageSize();
+    pageStride_ = (page != 0UL) ? (((slotSize(ZONE_CAL_ELECTRIC) + page - 1UL) / page) * page) : 0UL;
+    uint32_t pagedSlots = 0UL;
+    for (uint8_t zone = 0U; zone < ZONE_COUNT; zone++) {
+        pagedSlots += LAYOUT[zone].paged ? LAYOUT[zone].slots : 0U;
+    }
+    if ((pageStride_ == 0UL) || (Hal::pageBegin() < pageStride_ * pagedSlots)) {
+        pageStride_ = 0UL;
+    }
+
+    for (uint8_t zone = 0U; zone < ZONE_COUNT; zone++) {
+        scan(zone);
+    }
+
+    if (newest_[ZONE_STATE].sequence != 0UL) {
+        Hal::nvRead(dataOffset(ZONE_STATE), &state_, sizeof(state_));
+    }
+    return true;
+}
+
+bool StateJournal::isAvailable() const {
+    return available_;
+}
+
+bool StateJournal::isCalibrationPersistent() const {
+    return available_ && (pageStride_ != 0UL);
+}
+
+uint32_t StateJournal::requiredSize() {
+    return NV_REQUIRED;
+}
+
+bool StateJournal::zoneAvailable(uint8_t zone) const {
+    return available_ && (!LAYOUT[zone].paged || (pageStride_ != 0UL));
+}
+
+void StateJournal::scan(uint8_t zone) {
+    // En-têtes seuls ; CRC complet uniquement pour un candidat plus récent
+    Newest& newest = newest_[zone];
+    newest.sequence = 0UL;
+    newest.size = 0U;
+    newest.slot = 0U;
+    if (!zoneAvailable(zone)) {
+        return;
+    }
+
+    for (uint8_t slot = 0U; slot < LAYOUT[zone].slots; slot++) {
+        const uint32_t offset = slotOffset(zone, slot);
+        Header header;
+        read(zone, offset, &header, sizeof(header));
+
+        const bool sized = LAYOUT[zone].exact
+            ? (header.size == LAYOUT[zone].capacity)
+            : (header.size <= LAYOUT[zone].capacity);
+
+        if ((header.magic == RECORD_MAGIC) && sized
+            && (header.sequence > newest.sequence) && verify(zone, offset, header)) {
+            newest.sequence = header.sequence;
+            newest.size = header.size;
+            newest.slot = slot;
+        }
+    }
+}
+
+// ============================================================================
+// ÉTAT
+// ============================================================================
+
+bool StateJournal::restoreState(State* state) const {
+    if (!available_ || (newest_[ZONE_STATE].sequence == 0UL)
+        || (state_.mode >= PowerDistribution::MODE_COUNT)) {
+        return false;
+    }
+
+    *state = state_;
+    return true;
+}
+
+bool StateJournal::saveState(const State& state) {
+    if (!available_ || ((newest_[ZONE_STATE].sequence != 0UL) && (state == state_))) {
+        return false;
+    }
+
+    uint32_t crc = 0UL;
+    uint32_t offset = beginRecord(ZONE_STATE, sizeof(state), &crc);
+    writePart(ZONE_STATE, &offset, &state, sizeof(state), &crc);
+    endRecord(ZONE_STATE, offset, sizeof(state), crc);
+
+    state_ = state;
+    return true;
+}
+
+uint32_t StateJournal::getStateSequence() const {
+    return newest_[ZONE_STATE].sequence;
+}
+
+// ============================================================================
+// STATISTIQUES
+// ============================================================================
+
+bool StateJournal::restoreUsage(UsageStats& usage) const {
+    if (!available_ || (newest_[ZONE_USAGE].sequence == 0UL)) {
+        return false;
+    }
+
+    uint32_t offset = dataOffset(ZONE_USAGE);
+    for (uint8_t m = 0U; m < PowerDistribution::MODE_COUNT; m++) {
+        UsageRecord record;
+        Hal::nvRead(offset, &record, sizeof(record));
+        offset += sizeof(record);
+
+        UsageStats::Mode stats = {};
+        stats.ticks = record.ticks;
+        stats.capped = record.capped;
+        stats.shortfall = record.shortfall;
+        for (uint8_t e = 0U; e < UsageStats::ENGINE_COUNT; e++) {
+            stats.engine[e].sum = record.sum[e];
+            stats.engine[e].min = record.min[e];
+            stats.engine[e].max = record.max[e];
+        }
+        usage.restoreMode(static_cast<PowerDistribution::FlightMode>(m), stats);
+    }
+    return true;
+}
+
+bool StateJournal::saveUsage(const UsageStats& usage) {
+    if (!available_) {
+        return false;
+    }
+
+    uint32_t crc = 0UL;
+    uint32_t offset = beginRecord(ZONE_USAGE, USAGE_SIZE, &crc);
+    for (uint8_t m = 0U; m < PowerDistribution::MODE_COUNT; m++) {
+        const UsageStats::Mode& stats = usage.getMode(static_cast<PowerDistribution::FlightMode>(m));
+
+        UsageRecord record = {};
+        record.ticks = stats.ticks;
+        record.capped = stats.capped;
+        record.shortfall = stats.shortfall;
+        for (uint8_t e = 0U; e < UsageStats::ENGINE_COUNT; e++) {
+            record.sum[e] = stats.engine[e].sum;
+            record.min[e] = stats.engine[e].min;
+            record.max[e] = stats.engine[e].max;
+        }
+        writePart(ZONE_USAGE, &offset, &record, sizeof(record), &crc);
+    }
+    endRecord(ZONE_USAGE, offset, USAGE_SIZE, crc);
+    return true;
+}
+
+// ============================================================================
+// CALIBRATION
+// ============================================================================
+
+bool StateJournal::restoreCalibration(CalibrationCurve& curve) const {
+    const uint8_t zone = (curve.getSource() == CalibrationCurve::Source::ELECTRIC)
+        ? ZONE_CAL_ELECTRIC : ZONE_CAL_THERMAL;
+
+    if (!zoneAvailable(zone) || (newest_[zone].sequence == 0UL) || (newest_[zone].size < sizeof(CalibrationPrefix))) {
+        return false;
+    }
+
+    uint32_t offset = dataOffset(zone);
+    CalibrationPrefix prefix;
+    Hal::pageRead(offset, &prefix, sizeof(prefix));
+    offset += sizeof(prefix);
+
+    if ((prefix.count == 0U)
+        || (newest_[zone].size != sizeof(prefix) + (prefix.count * sizeof(uint32_t)))
+        || !curve.beginLoad(prefix.shift, prefix.count)) {
+        return false;
+    }
+
+    for (uint16_t i = 0U; i < prefix.count; i++) {
+        uint32_t watts = 0UL;
+        Hal::pageRead(offset, &watts, sizeof(watts));
+        offset += sizeof(watts);
+        if (!curve.appendPoint(watts)) {
+            return false;
+        }
+    }
+    return curve.commitLoad();
+}
+
+bool StateJournal::saveCalibration(const CalibrationCurve& curve) {
+    const uint8_t zone = (curve.getSource() == CalibrationCurve::Source::ELECTRIC)
+        ? ZONE_CAL_ELECTRIC : ZONE_CAL_THERMAL;
+
+    if (!zoneAvailable(zone)) {
+        return false;
+    }
+
+    CalibrationPrefix prefix;
+    prefix.shift = curve.getShift();
+    prefix.reserved = 0U;
+    prefix.count = curve.isDefault() ? 0U : curve.getCount();
+
+    const uint16_t size = static_cast<uint16_t>(sizeof(prefix) + (prefix.count * sizeof(uint32_t)));
+    uint32_t crc = 0UL;
+    uint32_t offset = beginRecord(zone, size, &crc);
+    writePart(zone, &offset, &prefix, sizeof(prefix), &crc);
+    for (uint16_t i = 0U; i < prefix.count; i++) {
+        const uint32_t watts = curve.getPoint(i);
+        writePart(zone, &offset, &watts, sizeof(watts), &crc);
+    }
+    endRecord(zone, offset, size, crc);
+    return true;
+}
+
+// ============================================================================
+// ÉCRITURE
+// ============================================================================
+
+void StateJournal::commit() {
+    if (available_) {
+        Hal::nvCommit();
+    }
+}
+
+uint32_t StateJournal::slotStride(uint8_t zone) const {
+    return LAYOUT[zone].paged ? pageStride_ : slotSize(zone);
+}
+
+uint32_t StateJournal::slotOffset(uint8_t zone, uint8_t slot) const {
+    // Zones EEPROM depuis 0, zones de pages depuis le début de leur zone
+    uint32_t base = 0UL;
+    for (uint8_t z = 0U; z < zone; z++) {
+        if (LAYOUT[z].paged == LAYOUT[zone].paged) {
+            base += slotStride(z) * LAYOUT[z].slots;
+        }
+    }
+    return base + (slotStride(zone) * slot);
+}
+
+uint32_t StateJournal::dataOffset(uint8_t zone) const {
+    return slotOffset(zone, newest_[zone].slot) + sizeof(Header);
+}
+
+uint32_t StateJournal::beginRecord(uint8_t zone, uint16_t size, uint32_t* crc) {
+    // Emplacement suivant le plus récent: le précédent reste intact
+    const Newest& newest = newest_[zone];
+    const uint8_t slot = (newest.sequence == 0UL) ? 0U
+        : static_cast<uint8_t>((newest.slot + 1U) % LAYOUT[zone].slots);
+
+    Header header;
+    header.magic = RECORD_MAGIC;
+    header.size = size;
+    header.sequence = newest.sequence + 1UL;
+
+    uint32_t offset = slotOffset(zone, slot);
+    if (LAYOUT[zone].paged) {
+        // Pages de l'emplacement effacées avant programmation (bloquant)
+        const uint32_t page = Hal::pageSize();
+        for (uint32_t erased = 0UL; erased < pageStride_; erased += page) {
+            Hal::pageErase(offset + erased);
+        }
+    }
+
+    *crc = 0UL;
+    writePart(zone, &offset, &header, sizeof(header), crc);
+    return offset;
+}
+
+void StateJournal::writePart(uint8_t zone, uint32_t* offset, const void* data, uint16_t size, uint32_t* crc) {
+    write(zone, *offset, data, size);
+    *crc = Crc::crc32(data, size, *crc);
+    *offset += size;
+}
+
+void StateJournal::endRecord(uint8_t zone, uint32_t offset, uint16_t size, uint32_t crc) {
+    write(zone, offset, &crc, sizeof(crc));
+
+    Newest& newest = newest_[zone];
+    newest.slot = (newest.sequence == 0UL) ? 0U
+        : static_cast<uint8_t>((newest.slot + 1U) % LAYOUT[zone].slots);
+    newest.sequence++;
+    newest.size = size;
+}
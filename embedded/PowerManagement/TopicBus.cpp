@@ -0,0 +1,40 @@
+/**
+ * @file TopicBus.cpp
+ * @brief Emplacements et compteurs du bus interne
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "TopicBus.h"
+
+namespace TopicBus {
+
+    Slots slots = {};
+    Counters counters[COUNT] = {};
+
+    namespace {
+        /** @brief Noms (rang = identifiant) */
+        const char* const NAMES[COUNT] = {
+#define TOPIC_CATALOG_NAME(name, type, label) #name,
+            TOPIC_CATALOG(TOPIC_CATALOG_NAME)
+#undef TOPIC_CATALOG_NAME
+        };
+
+        /** @brief Libellés (rang = identifiant) */
+        const char* const LABELS[COUNT] = {
+#define TOPIC_CATALOG_LABEL(name, type, label) label,
+            TOPIC_CATALOG(TOPIC_CATALOG_LABEL)
+#undef TOPIC_CATALOG_LABEL
+        };
+    }
+
+    const char* labelOf(Topic topic) {
+        const uint8_t index = static_cast<uint8_t>(topic);
+        return (index < COUNT) ? LABELS[index] : "?";
+    }
+
+    const char* nameOf(Topic topic) {
+        const uint8_t index = static_cast<uint8_t>(topic);
+        return (index < COUNT) ? NAMES[index] : "?";
+    }
+}
@@ -0,0 +1,198 @@
+/**
+ * @file TopicBus.h
+ * @brief Bus interne publication/abonnement statique, sans allocation ni copie
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Un emplacement préalloué par sujet: le producteur écrit le message en
+ * place (claim()) puis incrémente la version (publish(), O(1)). Les
+ * abonnés consultent la version depuis leur propre tâche et lisent le
+ * message par référence: un nouvel abonné ne coûte rien au producteur,
+ * donc rien au tick de contrôle. Compteurs par sujet: publications,
+ * abonnés, livraisons (fan-out) et versions sautées par les abonnés.
+ *
+ * Contexte unique (loop()): le message n'est pas protégé contre une
+ * écriture concurrente, voir Seqlock.h pour un partage avec une
+ * interruption.
+ *
+ * Règles:
+ * - Ajouter les nouveaux sujets EN FIN de liste (l'identifiant = rang)
+ * - Un élément par ligne, format "X(NOM, Type, "libellé")"
+ */
+
+#ifndef TOPIC_BUS_H
+#define TOPIC_BUS_H
+
+#include <stdint.h>
+#include "PowerDistribution.h"
+
+namespace TopicBus {
+
+    /**
+     * @brief Sortie d'un tick de contrôle
+     */
+    struct CommandMessage {
+        PowerDistribution::PowerOutput command;  ///< Commandes moteurs écrites (Cv)
+        PowerDistribution::FlightMode mode;      ///< Mode actif
+        bool deficit;                            ///< Répartition < demande (batterie, plafonds)
+    };
+
+    /**
+     * @brief État batterie après le tick
+     */
+    struct BatteryMessage {
+        uint16_t soc;         ///< État de charge (‰)
+        uint16_t boostTime;   ///< Autonomie au plafond électrique (s)
+    };
+}
+
+#define TOPIC_CATALOG(X) \
+    X(COMMAND, TopicBus::CommandMessage, "commandes moteurs par tick") \
+    X(BATTERY, TopicBus::BatteryMessage, "batterie par tick")
+
+namespace TopicBus {
+
+    /**
+     * @brief Identifiants des sujets (rang dans TOPIC_CATALOG)
+     */
+    enum class Topic : uint8_t {
+#define TOPIC_CATALOG_ID(name, type, label) name,
+        TOPIC_CATALOG(TOPIC_CATALOG_ID)
+#undef TOPIC_CATALOG_ID
+        COUNT
+    };
+
+    /** @brief Nombre de sujets */
+    constexpr uint8_t COUNT = static_cast<uint8_t>(Topic::COUNT);
+
+    /**
+     * @brief Type du message d'un sujet (résolu à la compilation)
+     */
+    template<Topic T> struct Message;
+#define TOPIC_CATALOG_TYPE(name, type, label) \
+    template<> struct Message<Topic::name> { typedef type Type; };
+    TOPIC_CATALOG(TOPIC_CATALOG_TYPE)
+#undef TOPIC_CATALOG_TYPE
+
+    /**
+     * @brief Emplacements des messages, un membre par sujet
+     */
+    struct Slots {
+#define TOPIC_CATALOG_SLOT(name, type, label) type name;
+        TOPIC_CATALOG(TOPIC_CATALOG_SLOT)
+#undef TOPIC_CATALOG_SLOT
+    };
+
+    /**
+     * @brief Compteurs d'un sujet
+     */
+    struct Counters {
+        uint32_t version;      ///< Publications (0 = jamais publié)
+        uint32_t deliveries;   ///< Nouvelles versions vues par les abonnés
+        uint32_t skipped;      ///< Versions remplacées avant lecture
+        uint8_t subscribers;   ///< Abonnés déclarés
+    };
+
+    /** @brief Messages (définis dans TopicBus.cpp) */
+    extern Slots slots;
+
+    /** @brief Compteurs par sujet (définis dans TopicBus.cpp) */
+    extern Counters counters[COUNT];
+
+    /**
+     * @brief Emplacement d'un sujet
+     */
+    template<Topic T> typename Message<T>::Type& slot();
+#define TOPIC_CATALOG_ACCESS(name, type, label) \
+    template<> inline type& slot<Topic::name>() { return slots.name; }
+    TOPIC_CATALOG(TOPIC_CATALOG_ACCESS)
+#undef TOPIC_CATALOG_ACCESS
+
+    /**
+     * @brief Message à remplir en place (producteur unique du sujet)
+     *
+     * @return Emplacement du sujet, valide jusqu'à publish()
+     */
+    template<Topic T>
+    inline typename Message<T>::Type& claim() {
+        return slot<T>();
+    }
+
+    /**
+     * @brief Publie le message rempli (version + 1)
+     */
+    template<Topic T>
+    inline void publish() {
+        counters[static_cast<uint8_t>(T)].version++;
+    }
+
+    /**
+     * @brief Dernier message publié (lecture directe, sans abonnement)
+     */
+    template<Topic T>
+    inline const typename Message<T>::Type& read() {
+        return slot<T>();
+    }
+
+    /**
+     * @brief Version courante d'un sujet
+     */
+    inline uint32_t versionOf(Topic topic) {
+        return counters[static_cast<uint8_t>(topic)].version;
+    }
+
+    /**
+     * @brief Libellé d'un sujet
+     */
+    const char* labelOf(Topic topic);
+
+    /**
+     * @brief Nom d'un sujet (identifiant du catalogue)
+     */
+    const char* nameOf(Topic topic);
+
+    /**
+     * @brief Abonnement à un sujet
+     *
+     * Déclaré en global ou en membre (compte d'abonnés à la construction).
+     * Chaque tâche consommatrice interroge poll() à son rythme.
+     */
+    template<Topic T>
+    class Subscriber {
+    public:
+        Subscriber()
+            : seen_(0U)
+        {
+            counters[static_cast<uint8_t>(T)].subscribers++;
+        }
+
+        /**
+         * @brief Nouvelles publications depuis l'appel précédent
+         *
+         * @return Nombre de versions publiées depuis (0 = rien de neuf)
+         */
+        uint32_t poll() {
+            Counters& topic = counters[static_cast<uint8_t>(T)];
+            const uint32_t pending = topic.version - seen_;
+
+            if (pending != 0U) {
+                seen_ = topic.version;
+                topic.deliveries++;
+                topic.skipped += pending - 1U;
+            }
+            return pending;
+        }
+
+        /**
+         * @brief Dernier message publié (référence sur l'emplacement)
+         */
+        const typename Message<T>::Type& get() const {
+            return slot<T>();
+        }
+
+    private:
+        uint32_t seen_;  ///< Dernière version consommée
+    };
+}
+
+#endif // TOPIC_BUS_H
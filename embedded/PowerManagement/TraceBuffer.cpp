@@ -0,0 +1,58 @@
+/**
+ * @file TraceBuffer.cpp
+ * @brief Implémentation du journal circulaire d'événements
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "TraceBuffer.h"
+
+// ============================================================================
+// INITIALISATION
+// ============================================================================
+
+bool TraceBuffer::begin(bool preserve) {
+    if (preserve && (magic_ == MAGIC)) {
+        return true;
+    }
+
+    head_ = 0U;
+    for (uint16_t i = 0U; i < TRACE_BUFFER_SIZE; i++) {
+        entries_[i].timestamp = 0U;
+        entries_[i].data = 0U;
+    }
+    magic_ = MAGIC;
+
+    return false;
+}
+
+// ============================================================================
+// LECTURE
+// ============================================================================
+
+uint32_t TraceBuffer::getEventCount() const {
+    return __atomic_load_n(&head_, __ATOMIC_RELAXED);
+}
+
+uint16_t TraceBuffer::getSize() const {
+    const uint32_t count = getEventCount();
+    return (count < TRACE_BUFFER_SIZE) ? static_cast<uint16_t>(count) : TRACE_BUFFER_SIZE;
+}
+
+bool TraceBuffer::getEntry(uint32_t first, uint16_t index, Entry* entry) const {
+    const uint32_t position = first + index;
+    const Entry& slot = entries_[position & (TRACE_BUFFER_SIZE - 1U)];
+
+    // Marqueur relu après l'horodatage: une réécriture entre les deux lectures est écartée
+    const uint32_t data = __atomic_load_n(&slot.data, __ATOMIC_ACQUIRE);
+    const uint32_t timestamp = __atomic_load_n(&slot.timestamp, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (((data & MARKER_MASK) != markerOf(position))
+        || (__atomic_load_n(&slot.data, __ATOMIC_RELAXED) != data)) {
+        return false;
+    }
+
+    entry->timestamp = timestamp;
+    entry->data = data;
+    return true;
+}
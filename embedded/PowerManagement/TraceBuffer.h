@@ -0,0 +1,156 @@
+/**
+ * @file TraceBuffer.h
+ * @brief Boîte noire : journal circulaire des derniers événements en RAM
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Toujours actif, indépendant de tout enregistrement externe. Chaque
+ * événement coûte un horodatage et un mot 32 bits ; l'écriture est sans
+ * verrou et utilisable depuis une interruption comme depuis loop().
+ */
+
+#ifndef TRACE_BUFFER_H
+#define TRACE_BUFFER_H
+
+#include <stdint.h>
+#include "config.h"
+#include "Hal.h"
+
+/**
+ * @brief Journal circulaire d'événements horodatés
+ *
+ * Format du mot de donnée: [31:28] marqueur, [27:24] événement, [23:12]
+ * champ A, [11:0] champ B (champs saturés à 4095, suffisant pour toute
+ * puissance en Cv). Le marqueur (bit 31 valide, [30:28] tour du tampon)
+ * est effacé à la réservation et reposé en dernier: un lecteur écarte une
+ * entrée pas encore écrite ou déjà réécrite par le tour suivant.
+ *
+ * Le constructeur est trivial pour que l'instance puisse être placée en
+ * HAL_NOINIT et survivre à un reset watchdog ; begin() valide le contenu.
+ */
+class TraceBuffer {
+public:
+    /**
+     * @brief Types d'événements tracés
+     */
+    enum class Event : uint8_t {
+        BOOT = 0U,         ///< Démarrage (A: cause du reset)
+        MODE_CHANGE = 1U,  ///< Changement de mode (A: ancien, B: nouveau)
+        SETPOINT = 2U,     ///< Nouvelle consigne (A: électrique, B: thermique)
+        SATURATION = 3U,   ///< Demande au-delà du plafond (A: demandé, B: thermique appliqué)
+        OVERRUN = 4U       ///< Dépassement de budget tâche (A: tâche, B: durée ms)
+    };
+
+    /**
+     * @brief Entrée du journal (8 octets)
+     */
+    struct Entry {
+        uint32_t timestamp;  ///< Horodatage (µs)
+        uint32_t data;       ///< Mot de donnée compacté
+    };
+
+    /**
+     * @brief Valeur maximale d'un champ A/B
+     */
+    static constexpr uint16_t FIELD_MAX = 0x0FFFU;
+
+    TraceBuffer() = default;
+
+    /**
+     * @brief Initialise le journal au démarrage
+     *
+     * @param preserve Conserver le contenu s'il est valide (reset watchdog)
+     * @return true si un contenu valide a été conservé
+     */
+    bool begin(bool preserve);
+
+    /**
+     * @brief Enregistre un événement (sans verrou, ISR-safe)
+     *
+     * @param event Type d'événement
+     * @param a Champ A (saturé à FIELD_MAX)
+     * @param b Champ B (saturé à FIELD_MAX)
+     */
+    void record(Event event, uint16_t a, uint16_t b);
+
+    /**
+     * @brief Nombre total d'événements enregistrés depuis begin()
+     *
+     * @return Compteur (peut dépasser la capacité)
+     */
+    uint32_t getEventCount() const;
+
+    /**
+     * @brief Nombre d'entrées actuellement disponibles
+     *
+     * @return min(compteur, TRACE_BUFFER_SIZE)
+     */
+    uint16_t getSize() const;
+
+    /**
+     * @brief Accès chronologique aux entrées d'une fenêtre fixée
+     *
+     * @param first Rang de la plus ancienne entrée (getEventCount() -
+     *        getSize(), relevé une fois pour tout un parcours)
+     * @param index Décalage depuis first
+     * @param entry Copie de l'entrée
+     * @return false si l'entrée n'est pas encore écrite ou a été réécrite
+     */
+    bool getEntry(uint32_t first, uint16_t index, Entry* entry) const;
+
+    /**
+     * @brief Extrait le type d'événement d'un mot de donnée
+     */
+    static Event eventOf(uint32_t data) { return static_cast<Event>((data >> 24) & 0x0FU); }
+
+    /**
+     * @brief Extrait le champ A d'un mot de donnée
+     */
+    static uint16_t fieldA(uint32_t data) { return static_cast<uint16_t>((data >> 12) & FIELD_MAX); }
+
+    /**
+     * @brief Extrait le champ B d'un mot de donnée
+     */
+    static uint16_t fieldB(uint32_t data) { return static_cast<uint16_t>(data & FIELD_MAX); }
+
+private:
+    static_assert((TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1U)) == 0U,
+                  "TRACE_BUFFER_SIZE doit être une puissance de 2");
+
+    static constexpr uint32_t MAGIC = 0x54524143UL;  ///< "TRAC"
+    static constexpr uint32_t MARKER_MASK = 0xF0000000UL;  ///< Marqueur du mot de donnée
+
+    /**
+     * @brief Marqueur attendu pour le rang d'événement index
+     */
+    static uint32_t markerOf(uint32_t index) {
+        return 0x80000000UL | (((index / TRACE_BUFFER_SIZE) & 0x7UL) << 28);
+    }
+
+    uint32_t magic_;                          ///< Marqueur de contenu valide
+    uint32_t head_;                           ///< Nombre d'événements écrits
+    Entry entries_[TRACE_BUFFER_SIZE];        ///< Stockage circulaire
+};
+
+// ============================================================================
+// CHEMIN CRITIQUE (inline)
+// ============================================================================
+
+inline void TraceBuffer::record(Event event, uint16_t a, uint16_t b) {
+    // Réservation atomique du slot : un ISR qui préempte obtient le suivant
+    const uint32_t index = __atomic_fetch_add(&head_, 1UL, __ATOMIC_RELAXED);
+    Entry& entry = entries_[index & (TRACE_BUFFER_SIZE - 1U)];
+
+    // Marqueur effacé avant l'horodatage, mot complet publié en dernier
+    __atomic_store_n(&entry.data, 0UL, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&entry.timestamp, static_cast<uint32_t>(Hal::micros()), __ATOMIC_RELAXED);
+    __atomic_store_n(&entry.data,
+        markerOf(index)
+            | (static_cast<uint32_t>(event) << 24)
+            | (static_cast<uint32_t>((a < FIELD_MAX) ? a : FIELD_MAX) << 12)
+            | static_cast<uint32_t>((b < FIELD_MAX) ? b : FIELD_MAX),
+        __ATOMIC_RELEASE);
+}
+
+#endif // TRACE_BUFFER_H
@@ -0,0 +1,45 @@
+/**
+ * @file TurbineSpool.cpp
+ * @brief Implémentation du modèle de réponse turbine
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "TurbineSpool.h"
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+TurbineSpool::TurbineSpool()
+    : delivered_(0U)
+    , gain_(65536)
+{
+}
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+void TurbineSpool::setTimeConstant(uint16_t tauMs, uint16_t tickMs) {
+    const uint32_t period = (tickMs == 0U) ? 1U : tickMs;
+    gain_ = static_cast<int32_t>((period << 16) / (static_cast<uint32_t>(tauMs) + period));
+}
+
+void TurbineSpool::reset(uint16_t value) {
+    delivered_ = static_cast<uint32_t>(value) << 16;
+}
+
+// ============================================================================
+// MODÈLE
+// ============================================================================
+
+void TurbineSpool::tick(uint16_t commanded) {
+    // Écart sur 33 bits signés ; gain ≤ 1: l'état reste entre lui-même et la consigne
+    const int64_t error = static_cast<int64_t>(static_cast<uint32_t>(commanded) << 16) - delivered_;
+    delivered_ = static_cast<uint32_t>(delivered_ + ((error * gain_) >> 16));
+}
+
+uint16_t TurbineSpool::getDelivered() const {
+    return static_cast<uint16_t>((delivered_ + 0x8000UL) >> 16);
+}
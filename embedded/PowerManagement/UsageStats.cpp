@@ -0,0 +1,91 @@
+/**
+ * @file UsageStats.cpp
+ * @brief Implémentation des statistiques d'utilisation
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "UsageStats.h"
+
+// ============================================================================
+// INITIALISATION
+// ============================================================================
+
+bool UsageStats::begin(bool preserve) {
+    if (preserve && (magic_ == MAGIC)) {
+        return true;
+    }
+
+    clear();
+    return false;
+}
+
+void UsageStats::clear() {
+    for (uint8_t m = 0U; m < PowerDistribution::MODE_COUNT; m++) {
+        Mode& mode = modes_[m];
+        mode.ticks = 0U;
+        mode.capped = 0U;
+        mode.shortfall = 0U;
+
+        for (uint8_t e = 0U; e < ENGINE_COUNT; e++) {
+            Engine& engine = mode.engine[e];
+            for (uint8_t b = 0U; b < BAND_COUNT; b++) {
+                engine.bands[b] = 0U;
+            }
+            engine.sum = 0U;
+            engine.min = 0xFFFFU;
+            engine.max = 0U;
+        }
+    }
+
+    magic_ = MAGIC;
+}
+
+// ============================================================================
+// CUMUL (par tick)
+// ============================================================================
+
+void UsageStats::record(PowerDistribution::FlightMode mode, const PowerDistribution::PowerOutput& command, bool shortfall) {
+    const uint8_t index = static_cast<uint8_t>(mode);
+    if (index >= PowerDistribution::MODE_COUNT) {
+        return;
+    }
+
+    Mode& stats = modes_[index];
+    const uint16_t power[ENGINE_COUNT] = { command.electric, command.thermal };
+
+    stats.ticks++;
+    stats.shortfall += shortfall ? 1U : 0U;
+
+    for (uint8_t e = 0U; e < ENGINE_COUNT; e++) {
+        Engine& engine = stats.engine[e];
+        engine.bands[bandOf(power[e])]++;
+        engine.sum += power[e];
+        engine.min = (power[e] < engine.min) ? power[e] : engine.min;
+        engine.max = (power[e] > engine.max) ? power[e] : engine.max;
+    }
+}
+
+void UsageStats::recordCapped(PowerDistribution::FlightMode mode) {
+    const uint8_t index = static_cast<uint8_t>(mode);
+    if (index < PowerDistribution::MODE_COUNT) {
+        modes_[index].capped++;
+    }
+}
+
+// ============================================================================
+// LECTURE
+// ============================================================================
+
+const UsageStats::Mode& UsageStats::getMode(PowerDistribution::FlightMode mode) const {
+    const uint8_t index = static_cast<uint8_t>(mode);
+    return modes_[(index < PowerDistribution::MODE_COUNT) ? index : 0U];
+}
+
+void UsageStats::restoreMode(PowerDistribution::FlightMode mode, const Mode& stats) {
+    const uint8_t index = static_cast<uint8_t>(mode);
+    if (index < PowerDistribution::MODE_COUNT) {
+        modes_[index] = stats;
+        magic_ = MAGIC;
+    }
+}
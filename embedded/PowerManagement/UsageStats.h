@@ -0,0 +1,123 @@
+/**
+ * @file UsageStats.h
+ * @brief Statistiques d'utilisation par mode et par moteur (maintenance)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Accumulateurs en flux, empreinte fixe (~0,5 Ko) : temps par mode,
+ * histogramme du temps par bande de puissance sur 0..3750 Cv, min/max/
+ * moyenne, saturations. Mise à jour O(1) par tick (un décalage pour la
+ * bande, aucune division).
+ */
+
+#ifndef USAGE_STATS_H
+#define USAGE_STATS_H
+
+#include <stdint.h>
+#include "config.h"
+#include "PowerDistribution.h"
+
+/**
+ * @brief Cumul d'utilisation depuis la dernière mise sous tension
+ *
+ * Le constructeur est trivial pour que l'instance puisse être placée en
+ * HAL_NOINIT et survivre aux resets logiciels et watchdog ; begin()
+ * valide le contenu.
+ */
+class UsageStats {
+public:
+    /** @brief Moteurs suivis (électrique, thermique) */
+    static constexpr uint8_t ENGINE_COUNT = 2U;
+
+    /** @brief Bandes de 2^USAGE_BAND_SHIFT Cv couvrant 0..UrgenceConfig::MAX_POWER */
+    static constexpr uint8_t BAND_COUNT = static_cast<uint8_t>((UrgenceConfig::MAX_POWER >> USAGE_BAND_SHIFT) + 1U);
+
+    /**
+     * @brief Cumul d'un moteur dans un mode
+     */
+    struct Engine {
+        uint32_t bands[BAND_COUNT];  ///< Ticks par bande de puissance
+        uint64_t sum;                ///< Somme des commandes (Cv·tick), moyenne = sum / ticks
+        uint16_t min;                ///< Commande minimale (Cv), 0xFFFF si aucun tick
+        uint16_t max;                ///< Commande maximale (Cv)
+    };
+
+    /**
+     * @brief Cumul d'un mode de vol
+     */
+    struct Mode {
+        uint32_t ticks;               ///< Ticks passés dans le mode
+        uint32_t capped;              ///< Demandes écrêtées au plafond du mode
+        uint32_t shortfall;           ///< Ticks où la répartition ne couvre pas la demande
+        Engine engine[ENGINE_COUNT];  ///< Indexé par PowerAllocator::Source (ELECTRIC, THERMAL)
+    };
+
+    UsageStats() = default;
+
+    /**
+     * @brief Initialise les cumuls au démarrage
+     *
+     * @param preserve Conserver le contenu s'il est valide (reset à chaud)
+     * @return true si un contenu valide a été conservé
+     */
+    bool begin(bool preserve);
+
+    /**
+     * @brief Remet tous les cumuls à zéro
+     */
+    void clear();
+
+    /**
+     * @brief Cumule un tick de contrôle
+     *
+     * @param mode Mode de vol actif
+     * @param command Commandes electric/thermal appliquées (Cv)
+     * @param shortfall Répartition inférieure à la demande (batterie, plafonds)
+     */
+    void record(PowerDistribution::FlightMode mode, const PowerDistribution::PowerOutput& command, bool shortfall);
+
+    /**
+     * @brief Compte une demande écrêtée au plafond du mode
+     *
+     * @param mode Mode de vol actif
+     */
+    void recordCapped(PowerDistribution::FlightMode mode);
+
+    /**
+     * @brief Cumul d'un mode
+     *
+     * @param mode Mode de vol
+     */
+    const Mode& getMode(PowerDistribution::FlightMode mode) const;
+
+    /**
+     * @brief Recharge le cumul d'un mode (restauration du journal)
+     *
+     * @param mode Mode de vol
+     * @param stats Cumul sauvegardé
+     */
+    void restoreMode(PowerDistribution::FlightMode mode, const Mode& stats);
+
+    /**
+     * @brief Bande d'une puissance
+     *
+     * @param power Puissance (Cv)
+     * @return Rang de bande, saturé à BAND_COUNT - 1
+     */
+    static uint8_t bandOf(uint16_t power) {
+        const uint16_t band = static_cast<uint16_t>(power >> USAGE_BAND_SHIFT);
+        return static_cast<uint8_t>((band < BAND_COUNT) ? band : (BAND_COUNT - 1U));
+    }
+
+private:
+    static_assert(static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC) == 0U
+                  && static_cast<uint8_t>(PowerAllocator::Source::THERMAL) == 1U,
+                  "UsageStats indexe les moteurs ELECTRIC/THERMAL en 0/1");
+
+    static constexpr uint32_t MAGIC = 0x55534745UL;  ///< "USGE"
+
+    uint32_t magic_;                                   ///< Marqueur de contenu valide
+    Mode modes_[PowerDistribution::MODE_COUNT];        ///< Cumul par mode
+};
+
+#endif // USAGE_STATS_H
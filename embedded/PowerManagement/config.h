@@ -19,6 +19,9 @@
 /** @brief Baudrate communication série (ARINC 429 simulé) */
 #define SERIAL_BAUDRATE 115200U
 
+/** @brief Délai du ping CRC confirmant une vitesse négociée ('b'), sinon repli (ms) */
+#define LINK_CONFIRM_TIMEOUT_MS 1000U
+
 /** @brief Pin encodeur rotatif - CLK */
 #define ENCODER_CLK_PIN 2
 
@@ -45,6 +48,10 @@ namespace DecollageConfig {
     constexpr uint16_t INITIAL_POWER = 50U; ///< Puissance initiale (Cv)
     constexpr uint16_t ELECTRIC_MAX = 1000U; ///< Plafond électrique (Cv)
     constexpr uint16_t THERMAL_MAX = 2250U;  ///< Plafond thermique (Cv)
+    constexpr uint16_t ELECTRIC_RAMP_UP = 2000U;   ///< Montée électrique (Cv/s)
+    constexpr uint16_t ELECTRIC_RAMP_DOWN = 2000U; ///< Descente électrique (Cv/s)
+    constexpr uint16_t THERMAL_RAMP_UP = 400U;     ///< Montée thermique (Cv/s)
+    constexpr uint16_t THERMAL_RAMP_DOWN = 600U;   ///< Descente thermique (Cv/s)
 }
 
 /** @brief Configuration mode NORMAL */
@@ -53,6 +60,10 @@ namespace NormalConfig {
     constexpr uint16_t MAX_POWER = 2750U;   ///< Puissance maximale (Cv)
     constexpr uint16_t INITIAL_POWER = 50U; ///< Puissance initiale (Cv)
     constexpr uint16_t THERMAL_MAX = 2750U;  ///< Plafond thermique (Cv)
+    constexpr uint16_t ELECTRIC_RAMP_UP = 2000U;   ///< Montée électrique (Cv/s)
+    constexpr uint16_t ELECTRIC_RAMP_DOWN = 2000U; ///< Descente électrique (Cv/s)
+    constexpr uint16_t THERMAL_RAMP_UP = 300U;     ///< Montée thermique (Cv/s)
+    constexpr uint16_t THERMAL_RAMP_DOWN = 500U;   ///< Descente thermique (Cv/s)
 }
 
 /** @brief Configuration mode URGENCE */
@@ -62,6 +73,10 @@ namespace UrgenceConfig {
     constexpr uint16_t INITIAL_POWER = 50U; ///< Puissance initiale (Cv)
     constexpr uint16_t ELECTRIC_MAX = 1000U; ///< Plafond électrique (Cv)
     constexpr uint16_t THERMAL_MAX = 2750U;  ///< Plafond thermique (Cv)
+    constexpr uint16_t ELECTRIC_RAMP_UP = 4000U;   ///< Montée électrique (Cv/s)
+    constexpr uint16_t ELECTRIC_RAMP_DOWN = 4000U; ///< Descente électrique (Cv/s)
+    constexpr uint16_t THERMAL_RAMP_UP = 800U;     ///< Montée thermique (Cv/s)
+    constexpr uint16_t THERMAL_RAMP_DOWN = 800U;   ///< Descente thermique (Cv/s)
 }
 
 // ============================================================================
@@ -77,12 +92,94 @@ namespace UrgenceConfig {
 /** @brief Intervalle transmission ARINC (ms) */
 #define ARINC_TX_INTERVAL 50U
 
+/** @brief Intervalle du mot d'état système ARINC_LABEL_SYSTEM_STATUS (ms, flux 'a') */
+#define ARINC_STATUS_INTERVAL 1000U
+
+/** @brief Fenêtre de mesure des métriques boucles/s et file TX (ms) */
+#define METRICS_WINDOW_MS 1000U
+
+/** @brief Période de la tâche de contrôle à cadence fixe (ms) */
+#define CONTROL_TICK_INTERVAL 20U
+
+/** @brief Durée du fondu de répartition lors d'un changement de mode (ms, 0 = immédiat) */
+#define MODE_BLEND_TIME_MS 2000U
+
+/** @brief Constante de temps turbine, consigne → puissance délivrée (ms, 0 = immédiat) */
+#define TURBINE_SPOOL_TAU_MS 1500U
+
+/** @brief Compensation du retard turbine par l'électrique active au démarrage (0/1) */
+#define SPOOL_COMPENSATION_DEFAULT 1
+
+/** @brief Puissance de décharge maximale de la batterie (Cv, plafond convertisseur) */
+#define BATTERY_MAX_POWER 1000U
+
+/** @brief Plafond physique de la chaîne (Cv): borne de maxPower/thermalMax des limites chargées ('k') */
+#define PLANT_MAX_POWER 8000U
+
 /** @brief Timeout boutons anti-rebond (ms) */
 #define BUTTON_DEBOUNCE_TIME 50U
 
 /** @brief Pas de l'encodeur (Cv par clic) */
 #define ENCODER_STEP 10U
 
+/** @brief Budget d'exécution d'une tâche avant trace de dépassement (µs) */
+#define TASK_OVERRUN_BUDGET_US 50000UL
+
+/** @brief Demi-période du clignotement de la LED de vie (ms) */
+#define LED_HEARTBEAT_INTERVAL 500U
+
+/** @brief Veille du cœur entre deux échéances (0 = boucle active, 1 = WFI/sleep) */
+#define LOW_POWER_IDLE 1
+
+// ============================================================================
+// ÉMISSION SÉRIE PAR CLASSE (SerialLink)
+// ============================================================================
+
+/** @brief File des événements de sûreté (octets, puissance de 2, jamais perdus) */
+#define OUTPUT_SAFETY_BUFFER 256U
+
+/** @brief File du texte opérateur (octets, puissance de 2, lignes perdues si pleine) */
+#define OUTPUT_UI_BUFFER 2048U
+
+/** @brief Emplacements de télémesure (une dernière valeur par clé) */
+#define OUTPUT_TELEMETRY_SLOTS 6U
+
+/** @brief Longueur maximale d'une valeur de télémesure (octets) */
+#define OUTPUT_TELEMETRY_LINE 80U
+
+// ============================================================================
+// BOÎTE NOIRE (TRACE)
+// ============================================================================
+
+/** @brief Capacité du journal d'événements (puissance de 2, 8 octets/entrée) */
+#define TRACE_BUFFER_SIZE 1024U
+
+/** @brief Entrées vidées entre deux rechargements du watchdog */
+#define TRACE_DUMP_KICK_INTERVAL 64U
+
+// ============================================================================
+// STATISTIQUES D'UTILISATION
+// ============================================================================
+
+/** @brief Largeur d'une bande de l'histogramme de puissance (log2 Cv, 8 = 256 Cv) */
+#define USAGE_BAND_SHIFT 8U
+
+// ============================================================================
+// ÉTAT PERSISTANT (StateJournal)
+// ============================================================================
+
+/** @brief Emplacements de l'anneau d'état (usure répartie sur ce nombre) */
+#define JOURNAL_STATE_SLOTS 32U
+
+/** @brief Stabilité requise avant d'enregistrer un nouvel état (ms) */
+#define JOURNAL_STATE_SETTLE_MS 5000U
+
+/** @brief Période d'enregistrement des statistiques d'utilisation (ms) */
+#define JOURNAL_USAGE_INTERVAL_MS 600000UL
+
+/** @brief Pages flash réservées aux courbes de calibration (sous la page d'émulation EEPROM) */
+#define JOURNAL_FLASH_PAGES 8U
+
 // ============================================================================
 // CONSTANTES DE CONVERSION
 // ============================================================================
@@ -90,10 +187,83 @@ namespace UrgenceConfig {
 /** @brief Conversion puissance : 100% = 2200W */
 #define POWER_CONVERSION_FACTOR 2200.0F
 
+/** @brief Conversion puissance en entier (W pour 100%), voir PowerUnits.h */
+#define POWER_CONVERSION_FACTOR_W 2200U
+
 /** @brief Turbine constante : 80% = 1760W */
 #define TURBINE_CONSTANT_PERCENT 80U
 #define TURBINE_CONSTANT_WATTS 1760.0F
 
+// ============================================================================
+// COURBES DE CALIBRATION
+// ============================================================================
+
+/** @brief Nombre maximal de points par courbe (grille uniforme) */
+#define CALIBRATION_MAX_POINTS 257U
+
+/** @brief Pas de grille maximal (log2 Cv) */
+#define CALIBRATION_MAX_SHIFT 12U
+
+// ============================================================================
+// BOUCLE FERMÉE (PowerLoop)
+// ============================================================================
+
+/** @brief Gains PID électrique (Q8: 256 = 1,0 ; Ki par s, Kd en s) */
+#define LOOP_ELECTRIC_KP 128
+#define LOOP_ELECTRIC_KI 1280
+#define LOOP_ELECTRIC_KD 0
+
+/** @brief Gains PID thermique (Q8: 256 = 1,0 ; Ki par s, Kd en s) */
+#define LOOP_THERMAL_KP 768
+#define LOOP_THERMAL_KI 192
+#define LOOP_THERMAL_KD 0
+
+/** @brief Bande d'établissement autour de la consigne (‰) */
+#define LOOP_SETTLE_BAND_PERMILLE 20U
+
+/** @brief Bande d'établissement minimale (Cv) */
+#define LOOP_SETTLE_BAND_MIN 5U
+
+// ============================================================================
+// BATTERIE
+// ============================================================================
+
+/** @brief Capacité nominale (mAh) */
+#define BATTERY_CAPACITY_MAH 20000UL
+
+/** @brief Tension à vide à pleine charge (mV) */
+#define BATTERY_VOLTAGE_FULL_MV 400000UL
+
+/** @brief Tension à vide à décharge complète (mV) */
+#define BATTERY_VOLTAGE_EMPTY_MV 300000UL
+
+/** @brief Tension minimale sous charge (mV) */
+#define BATTERY_CUTOFF_MV 280000UL
+
+/** @brief Résistance interne (mΩ) */
+#define BATTERY_RESISTANCE_MOHM 150UL
+
+/** @brief Courant de décharge maximal (multiple de la capacité, C-rate) */
+#define BATTERY_MAX_C_RATE 3UL
+
+/** @brief Réserve de charge non utilisée pour le boost (‰) */
+#define BATTERY_RESERVE_PERMILLE 100UL
+
+/** @brief Température ambiante et initiale (°C) */
+#define BATTERY_AMBIENT_C 25L
+
+/** @brief Début du déclassement en température (°C) */
+#define BATTERY_DERATE_START_C 45L
+
+/** @brief Fin du déclassement, courant nul (°C) */
+#define BATTERY_DERATE_END_C 60L
+
+/** @brief Capacité thermique du pack (J/K) */
+#define BATTERY_HEAT_CAPACITY_J_PER_K 20000UL
+
+/** @brief Constante de temps de refroidissement (s) */
+#define BATTERY_COOLING_TAU_S 900UL
+
 // ============================================================================
 // CODES ARINC 429 (Simulés)
 // ============================================================================
@@ -110,9 +280,31 @@ namespace UrgenceConfig {
 /** @brief Label ARINC - Mode de vol */
 #define ARINC_LABEL_FLIGHT_MODE 0x273
 
-/** @brief Label ARINC - Status système */
+/** @brief Label ARINC - Status système (mot Metrics::packStatus) */
 #define ARINC_LABEL_SYSTEM_STATUS 0x274
 
+/** @brief Label ARINC - Batterie (SoC, autonomie boost) */
+#define ARINC_LABEL_BATTERY 0x275
+
+// ============================================================================
+// JOURNALISATION
+// ============================================================================
+
+/**
+ * @brief Journalisation différée des messages de diagnostic
+ *
+ * 0: messages formatés en texte sur la cible (moniteur série standard)
+ * 1: trames binaires {id, arguments}, texte reconstruit par
+ *    tools/log_decoder.py (chaînes de LogCatalog.h non embarquées)
+ */
+#define LOG_DEFERRED 0
+
+/** @brief Octet de synchronisation d'une trame de log (absent du texte) */
+#define LOG_FRAME_SYNC 0x1EU
+
+/** @brief Nombre maximal d'arguments par message */
+#define LOG_MAX_ARGS 4U
+
 // ============================================================================
 // VERSION FIRMWARE
 // ============================================================================
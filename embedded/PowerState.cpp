@@ -0,0 +1,134 @@
+/**
+ * @file PowerState.cpp
+ * @brief Implémentation de l'état opérateur mémorisé
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "PowerState.h"
+
+namespace {
+    /** @brief Pleine échelle des barres (Cv) */
+    constexpr uint16_t BAR_SCALE_TOTAL = 4000U;
+    constexpr uint16_t BAR_SCALE_ELECTRIC = 1000U;
+    constexpr uint16_t BAR_SCALE_THERMAL = 2750U;
+
+    uint8_t barLength(uint16_t power, uint16_t scale) {
+        const uint32_t length = (static_cast<uint32_t>(power) * PowerState::BAR_WIDTH) / scale;
+        return (length < PowerState::BAR_WIDTH) ? static_cast<uint8_t>(length) : PowerState::BAR_WIDTH;
+    }
+}
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+PowerState::PowerState(const PowerDistribution& distribution,
+                       const CalibrationCurve& electricCurve,
+                       const CalibrationCurve& thermalCurve)
+    : distribution_(distribution)
+    , electricCurve_(electricCurve)
+    , thermalCurve_(thermalCurve)
+    , snapshot_()
+    , distributionRevision_(0U)
+    , electricRevision_(0U)
+    , thermalRevision_(0U)
+    , dirty_(true)
+{
+}
+
+// ============================================================================
+// ENTRÉES
+// ============================================================================
+
+void PowerState::setMode(PowerDistribution::FlightMode mode) {
+    const PowerDistribution::FlightMode previousMode = flight_.getMode();
+    const uint16_t previousPower = flight_.getTotalPower();
+
+    flight_.setMode(mode);
+    track(previousMode, previousPower);
+}
+
+PowerDistribution::FlightMode PowerState::getMode() const {
+    return flight_.getMode();
+}
+
+void PowerState::setTotalPower(uint16_t power) {
+    const uint16_t previousPower = flight_.getTotalPower();
+
+    flight_.setTotalPower(power);
+    track(flight_.getMode(), previousPower);
+}
+
+void PowerState::increasePower(uint16_t increment) {
+    const uint16_t previousPower = flight_.getTotalPower();
+
+    flight_.increasePower(increment);
+    track(flight_.getMode(), previousPower);
+}
+
+void PowerState::decreasePower(uint16_t decrement) {
+    const uint16_t previousPower = flight_.getTotalPower();
+
+    flight_.decreasePower(decrement);
+    track(flight_.getMode(), previousPower);
+}
+
+uint16_t PowerState::getTotalPower() const {
+    return flight_.getTotalPower();
+}
+
+void PowerState::track(PowerDistribution::FlightMode mode, uint16_t power) {
+    if (mode != flight_.getMode() || power != flight_.getTotalPower()) {
+        dirty_ = true;
+    }
+}
+
+// ============================================================================
+// INSTANTANÉ
+// ============================================================================
+
+const PowerState::Snapshot& PowerState::snapshot() {
+    if (dirty_
+        || distributionRevision_ != distribution_.getRevision()
+        || electricRevision_ != electricCurve_.getRevision()
+        || thermalRevision_ != thermalCurve_.getRevision()) {
+        refresh();
+    }
+    return snapshot_;
+}
+
+void PowerState::refresh() {
+    const PowerDistribution::FlightMode mode = flight_.getMode();
+    const PowerDistribution::PowerOutput output = distribution_.calculate(mode, flight_.getTotalPower());
+
+    const uint32_t electricWatts = electricCurve_.toWatts(output.electric);
+    const uint32_t thermalWatts = thermalCurve_.toWatts(output.thermal);
+
+    dirty_ = false;
+    distributionRevision_ = distribution_.getRevision();
+    electricRevision_ = electricCurve_.getRevision();
+    thermalRevision_ = thermalCurve_.getRevision();
+
+    // Entrées modifiées, résultat identique (ex. limite batterie hors
+    // de la plage utilisée): version inchangée, consommateurs au repos
+    if (snapshot_.version != 0U
+        && mode == snapshot_.mode
+        && output.electric == snapshot_.output.electric
+        && output.thermal == snapshot_.output.thermal
+        && output.total == snapshot_.output.total
+        && electricWatts == snapshot_.electricWatts
+        && thermalWatts == snapshot_.thermalWatts) {
+        return;
+    }
+
+    snapshot_.version++;
+    snapshot_.mode = mode;
+    snapshot_.output = output;
+    snapshot_.totalWatts = electricWatts + thermalWatts;
+    snapshot_.electricWatts = electricWatts;
+    snapshot_.thermalWatts = thermalWatts;
+    snapshot_.totalBar = barLength(output.total, BAR_SCALE_TOTAL);
+    snapshot_.electricBar = barLength(output.electric, BAR_SCALE_ELECTRIC);
+    snapshot_.thermalBar = barLength(output.thermal, BAR_SCALE_THERMAL);
+}
@@ -0,0 +1,137 @@
+/**
+ * @file PowerState.h
+ * @brief État opérateur (mode, consigne) et grandeurs dérivées mémorisées
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#ifndef POWER_STATE_H
+#define POWER_STATE_H
+
+#include <stdint.h>
+#include "PowerDistribution.h"
+#include "FlightMode.h"
+#include "Calibration.h"
+
+/**
+ * @brief Source unique du mode et de la consigne
+ *
+ * Les modifications passent par le store, qui marque l'état modifié ; la
+ * répartition de la consigne (PowerOutput), les watts et les longueurs
+ * de barres ne sont recalculés qu'à la lecture suivante, et seulement si
+ * une entrée a changé (mode, consigne, profils de PowerDistribution:
+ * limite batterie, échange de ModeLimits, ou courbe de calibration
+ * chargée). Les watts par source suivent les courbes de calibration
+ * (Calibration.h), le total est leur somme. Le numéro de version de
+ * l'instantané n'avance que si le résultat diffère: un consommateur qui
+ * retient la dernière version vue peut sauter tout son travail.
+ *
+ * Mutateurs et snapshot() depuis loop() uniquement.
+ */
+class PowerState {
+public:
+    /** @brief Largeur des barres du tableau de bord (caractères) */
+    static constexpr uint8_t BAR_WIDTH = 40U;
+
+    /**
+     * @brief Grandeurs dérivées de la consigne
+     */
+    struct Snapshot {
+        uint32_t version;                       ///< Avance à chaque changement de contenu
+        PowerDistribution::FlightMode mode;     ///< Mode actif
+        PowerDistribution::PowerOutput output;  ///< Répartition de la consigne (Cv)
+        uint32_t totalWatts;                    ///< Total (W, somme des sources)
+        uint32_t electricWatts;                 ///< Part électrique (W, courbe électrique)
+        uint32_t thermalWatts;                  ///< Part thermique (W, courbe thermique)
+        uint8_t totalBar;                       ///< Barre totale (0..BAR_WIDTH, 4000 Cv)
+        uint8_t electricBar;                    ///< Barre électrique (1000 Cv)
+        uint8_t thermalBar;                     ///< Barre thermique (2750 Cv)
+    };
+
+    /**
+     * @brief Constructeur (mode DÉCOLLAGE, puissance initiale)
+     *
+     * Les références doivent survivre au store.
+     *
+     * @param distribution Répartition par mode
+     * @param electricCurve Calibration moteur électrique (Cv → W)
+     * @param thermalCurve Calibration turbine (Cv → W)
+     */
+    PowerState(const PowerDistribution& distribution,
+               const CalibrationCurve& electricCurve,
+               const CalibrationCurve& thermalCurve);
+
+    /**
+     * @brief Change de mode (consigne re-contrainte aux limites du mode)
+     *
+     * @param mode Nouveau mode
+     */
+    void setMode(PowerDistribution::FlightMode mode);
+
+    /**
+     * @brief Mode actif
+     */
+    PowerDistribution::FlightMode getMode() const;
+
+    /**
+     * @brief Définit la consigne (contrainte aux limites du mode)
+     *
+     * @param power Puissance totale demandée (Cv)
+     */
+    void setTotalPower(uint16_t power);
+
+    /**
+     * @brief Augmente la consigne (saturée au maximum du mode)
+     *
+     * @param increment Pas (Cv)
+     */
+    void increasePower(uint16_t increment);
+
+    /**
+     * @brief Diminue la consigne (saturée au minimum du mode)
+     *
+     * @param decrement Pas (Cv)
+     */
+    void decreasePower(uint16_t decrement);
+
+    /**
+     * @brief Consigne courante
+     *
+     * @return Puissance totale demandée (Cv)
+     */
+    uint16_t getTotalPower() const;
+
+    /**
+     * @brief Instantané des grandeurs dérivées, recalculé si besoin
+     *
+     * O(1) sans modification depuis l'appel précédent (comparaison de
+     * révisions). La référence reste valide, son contenu change au
+     * prochain appel suivant une modification.
+     *
+     * @return Instantané courant
+     */
+    const Snapshot& snapshot();
+
+private:
+    FlightMode flight_;                        ///< Mode et consigne (limites ModeLimits)
+    const PowerDistribution& distribution_;    ///< Répartition par mode
+    const CalibrationCurve& electricCurve_;    ///< Calibration moteur
+    const CalibrationCurve& thermalCurve_;     ///< Calibration turbine
+    Snapshot snapshot_;                        ///< Dernier instantané calculé
+    uint16_t distributionRevision_;            ///< Révision des profils à ce calcul
+    uint16_t electricRevision_;                ///< Révision de la courbe électrique
+    uint16_t thermalRevision_;                 ///< Révision de la courbe thermique
+    bool dirty_;                               ///< Mode ou consigne modifié depuis
+
+    /**
+     * @brief Marque l'état modifié si le mode ou la consigne a changé
+     */
+    void track(PowerDistribution::FlightMode mode, uint16_t power);
+
+    /**
+     * @brief Recalcule l'instantané, version avancée si le contenu change
+     */
+    void refresh();
+};
+
+#endif // POWER_STATE_H
@@ -0,0 +1,148 @@
+/**
+ * @file SchedulePlayer.h
+ * @brief Lecture d'un programme de vol précalculé (« autothrottle »)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Programme = table d'étapes { durée, mode, puissance totale, électrique
+ * imposée } en flash (const) ou en RAM, par exemple produite par
+ * tools/mission_optimizer.cpp. Chaque tick avance un curseur: aucune
+ * recherche, coût O(1) quelle que soit la longueur du programme.
+ */
+
+#ifndef SCHEDULE_PLAYER_H
+#define SCHEDULE_PLAYER_H
+
+#include <stdint.h>
+#include "PowerDistribution.h"
+
+/**
+ * @brief Curseur de lecture d'un programme de vol
+ *
+ * Une commande opérateur suspend la lecture (curseur figé) ; resume()
+ * reprend à l'étape interrompue, pour le temps qu'il lui restait.
+ */
+class SchedulePlayer {
+public:
+    /**
+     * @brief Étape du programme
+     */
+    struct Entry {
+        uint16_t duration;   ///< Durée (s), > 0
+        uint8_t mode;        ///< Mode de vol (PowerDistribution::FlightMode)
+        uint16_t total;      ///< Puissance totale demandée (Cv)
+        uint16_t electric;   ///< Part électrique imposée (Cv), NO_OVERRIDE = répartition du mode
+    };
+
+    /**
+     * @brief État de lecture
+     */
+    enum class State : uint8_t {
+        IDLE = 0U,        ///< Arrêté
+        PLAYING = 1U,     ///< Lecture en cours
+        OVERRIDDEN = 2U,  ///< Suspendu par l'opérateur
+        DONE = 3U         ///< Programme terminé
+    };
+
+    /** @brief Pas de part électrique imposée */
+    static constexpr uint16_t NO_OVERRIDE = 0xFFFFU;
+
+    /**
+     * @brief Constructeur (aucun programme)
+     *
+     * @param tickMs Période d'appel de tick() (ms)
+     */
+    explicit SchedulePlayer(uint16_t tickMs);
+
+    /**
+     * @brief Associe un programme (la table n'est pas copiée)
+     *
+     * Vérifie chaque étape (durée non nulle, mode connu, part électrique
+     * imposée sous le plafond actif du mode, ModeLimits) ; arrête la
+     * lecture en cours.
+     *
+     * @param entries Étapes (doivent survivre au lecteur)
+     * @param count Nombre d'étapes
+     * @return true si le programme est accepté
+     */
+    bool load(const Entry* entries, uint16_t count);
+
+    /**
+     * @brief Démarre la lecture depuis la première étape
+     *
+     * @return true si un programme est chargé
+     */
+    bool start();
+
+    /**
+     * @brief Arrête la lecture
+     */
+    void stop();
+
+    /**
+     * @brief Suspend la lecture (reprise en main opérateur)
+     *
+     * @return true si la lecture était en cours
+     */
+    bool suspend();
+
+    /**
+     * @brief Reprend la lecture suspendue à l'étape courante
+     *
+     * @return true si la lecture était suspendue
+     */
+    bool resume();
+
+    /**
+     * @brief Avance le curseur d'une période
+     *
+     * @return true si l'étape courante a changé ou si le programme vient
+     *         de se terminer (l'appelant applique getEntry() ou libère)
+     */
+    bool tick();
+
+    /**
+     * @brief Étape courante (valide si un programme est chargé)
+     */
+    const Entry& getEntry() const;
+
+    /**
+     * @brief Mode de vol de l'étape courante
+     */
+    PowerDistribution::FlightMode getMode() const;
+
+    /**
+     * @brief Rang de l'étape courante
+     */
+    uint16_t getIndex() const;
+
+    /**
+     * @brief Nombre d'étapes du programme
+     */
+    uint16_t getCount() const;
+
+    /**
+     * @brief Temps restant dans l'étape courante (ms)
+     */
+    uint32_t getRemaining() const;
+
+    /**
+     * @brief État de lecture
+     */
+    State getState() const;
+
+    /**
+     * @brief Lecture en cours (ni arrêtée, ni suspendue, ni terminée)
+     */
+    bool isPlaying() const;
+
+private:
+    const Entry* entries_;   ///< Table d'étapes
+    uint16_t count_;         ///< Nombre d'étapes
+    uint16_t index_;         ///< Étape courante
+    uint32_t remaining_;     ///< Temps restant dans l'étape (ms)
+    uint16_t tickMs_;        ///< Période (ms)
+    State state_;            ///< État de lecture
+};
+
+#endif // SCHEDULE_PLAYER_H
@@ -0,0 +1,219 @@
+/**
+ * @file SerialLink.h
+ * @brief Port série instrumenté (octets TX/RX, classes de priorité d'émission)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Enveloppe de HardwareSerial utilisée à la place de Serial par le
+ * firmware: toutes les écritures passent par write(), ce qui permet de
+ * compter les octets dans Metrics sans toucher aux appels print().
+ *
+ * Émission par classe, chacune avec son propre budget de tampon:
+ * - SAFETY: événements (journal, changement de mode), jamais perdus ;
+ *   file pleine → attente active de la vidange
+ * - TELEMETRY: valeurs périodiques, un emplacement par clé ; une valeur
+ *   non encore émise est remplacée par la suivante
+ * - UI: texte opérateur (classe par défaut), ligne entière abandonnée
+ *   si la file est pleine
+ * pump() transfère vers l'UART dans la limite de sa place libre, par
+ * message entier et par ordre de priorité: l'appelant n'attend jamais
+ * le débit de la ligne (hors SAFETY saturée).
+ */
+
+#ifndef SERIAL_LINK_H
+#define SERIAL_LINK_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * @brief Flux série compté, émission par classes de priorité
+ */
+class SerialLink : public Stream {
+public:
+    /**
+     * @brief Classes d'émission, par priorité décroissante
+     */
+    enum class OutputClass : uint8_t {
+        SAFETY = 0,     ///< Événements de sûreté (jamais perdus)
+        TELEMETRY = 1,  ///< Valeurs périodiques (dernière valeur par clé)
+        UI = 2          ///< Texte opérateur (perdu en premier)
+    };
+
+    /** @brief Nombre de classes */
+    static constexpr uint8_t CLASS_COUNT = 3U;
+
+    /**
+     * @brief Compteurs d'une classe
+     */
+    struct ClassCounters {
+        uint32_t messages;   ///< Messages acceptés (lignes pour UI)
+        uint32_t bytes;      ///< Octets transmis à l'UART
+        uint32_t replaced;   ///< Valeurs remplacées avant émission (TELEMETRY)
+        uint32_t dropped;    ///< Messages perdus (UI: lignes, TELEMETRY: tronqués)
+        uint32_t waits;      ///< Écritures bloquées sur file pleine (SAFETY)
+        uint16_t peak;       ///< Occupation maximale de la file (octets)
+    };
+
+    /**
+     * @brief Constructeur
+     *
+     * @param port Port matériel enveloppé (doit survivre au lien)
+     */
+    explicit SerialLink(HardwareSerial& port);
+
+    /**
+     * @brief Ouvre le port
+     *
+     * @param baudrate Vitesse (bps)
+     */
+    void begin(uint32_t baudrate);
+
+    /**
+     * @brief Change de vitesse (négociation 'b')
+     *
+     * Vide d'abord les files à la vitesse courante (bloquant, ~0,2 s au
+     * pire à 115200), puis rouvre le port.
+     *
+     * @param baudrate Nouvelle vitesse (bps)
+     */
+    void setBaudrate(uint32_t baudrate);
+
+    /**
+     * @brief Vitesse courante (bps)
+     */
+    uint32_t getBaudrate() const;
+
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+    int availableForWrite() override;
+    void flush() override;
+    int available() override;
+    int read() override;
+    int peek() override;
+
+    /**
+     * @brief Ouvre un message: les écritures suivantes vont dans sa classe
+     *
+     * @param outputClass Classe du message
+     * @param key Emplacement TELEMETRY (< OUTPUT_TELEMETRY_SLOTS), ignoré sinon
+     */
+    void beginMessage(OutputClass outputClass, uint8_t key = 0U);
+
+    /**
+     * @brief Ferme le message (retour à la classe UI)
+     */
+    void endMessage();
+
+    /**
+     * @brief Transfère les files vers l'UART sans attendre
+     *
+     * À appeler à chaque passage de boucle et à chaque réveil.
+     */
+    void pump();
+
+    /**
+     * @brief Attend que la file UI puisse accepter un volume donné
+     *
+     * Pour les vidages demandés explicitement (journal boîte noire): la
+     * sortie est complète au prix d'une attente bornée par le débit.
+     *
+     * @param bytes Octets à accepter sans perte
+     */
+    void waitForUi(uint16_t bytes);
+
+    /**
+     * @brief Délai de veille maximal tant que des files attendent l'UART
+     *
+     * @return Temps d'émission d'un demi-tampon UART à la vitesse courante
+     *         (µs), 0 si les files logicielles sont vides
+     */
+    uint32_t getRefillUs() const;
+
+    /**
+     * @brief Compteurs d'une classe
+     */
+    const ClassCounters& getCounters(OutputClass outputClass) const;
+
+    /**
+     * @brief Octets en attente d'émission (files logicielles + UART)
+     *
+     * @return Profondeur de la file TX (octets, saturée à 65535)
+     */
+    uint16_t getTxQueue();
+
+private:
+    /** @brief Aucune classe en cours d'émission */
+    static constexpr uint8_t NO_CLASS = 0xFFU;
+
+    /**
+     * @brief Valeur périodique en attente
+     */
+    struct TelemetrySlot {
+        uint8_t data[OUTPUT_TELEMETRY_LINE];  ///< Message
+        uint8_t length;                       ///< Octets écrits
+        bool pending;                         ///< Complet, non encore émis
+        bool truncated;                       ///< Dépassement de OUTPUT_TELEMETRY_LINE
+        uint16_t order;                       ///< Rang de fermeture (FIFO entre clés)
+    };
+
+    HardwareSerial& port_;  ///< Port matériel
+    uint32_t baudrate_;     ///< Vitesse courante (bps)
+
+    uint8_t safety_[OUTPUT_SAFETY_BUFFER];  ///< File SAFETY (anneau)
+    uint16_t safetyHead_;                   ///< Écriture (index libre)
+    uint16_t safetyTail_;                   ///< Lecture (index libre)
+
+    uint8_t ui_[OUTPUT_UI_BUFFER];          ///< File UI (anneau)
+    uint16_t uiHead_;                       ///< Écriture (index libre)
+    uint16_t uiTail_;                       ///< Lecture (index libre)
+    uint16_t uiLineStart_;                  ///< Début de la ligne en cours d'écriture
+    bool uiDropping_;                       ///< Ligne en cours abandonnée
+    bool uiLineCut_;                        ///< Ligne abandonnée déjà en partie émise
+
+    TelemetrySlot telemetry_[OUTPUT_TELEMETRY_SLOTS];  ///< Dernière valeur par clé
+    uint8_t inFlight_[OUTPUT_TELEMETRY_LINE];          ///< Valeur en cours d'émission
+    uint8_t inFlightLength_;                           ///< Octets de la valeur
+    uint8_t inFlightSent_;                             ///< Octets déjà transmis
+    uint16_t telemetryOrder_;                          ///< Compteur de fermetures
+
+    OutputClass class_;     ///< Classe des écritures en cours
+    uint8_t key_;           ///< Emplacement TELEMETRY ouvert
+    uint8_t txClass_;       ///< Classe en cours d'émission (NO_CLASS entre messages)
+    ClassCounters counters_[CLASS_COUNT];  ///< Compteurs par classe
+
+    /**
+     * @brief Range un octet dans la file de la classe courante
+     *
+     * @return 1 si accepté, 0 si abandonné (UI pleine)
+     */
+    size_t queue(uint8_t byte);
+
+    /**
+     * @brief Reste-t-il des octets dans les files logicielles ?
+     */
+    bool hasBacklog() const;
+
+    /**
+     * @brief Choisit la prochaine classe à émettre (priorité décroissante)
+     */
+    uint8_t nextClass();
+
+    /**
+     * @brief Émet au plus room octets d'un anneau
+     *
+     * @param stopAtLine Arrêt après un '\n' (fin de message UI)
+     * @return Octets transmis
+     */
+    uint16_t drainRing(const uint8_t* ring, uint16_t size, uint16_t head, uint16_t* tail,
+                       uint16_t room, bool stopAtLine);
+
+    /**
+     * @brief Retient le maximum d'occupation d'une classe
+     */
+    void trackPeak(OutputClass outputClass, uint16_t used);
+};
+
+#endif // SERIAL_LINK_H
@@ -0,0 +1,87 @@
+/**
+ * @file SetpointRamp.h
+ * @brief Générateur de rampe (limitation de pente) pour une consigne
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#ifndef SETPOINT_RAMP_H
+#define SETPOINT_RAMP_H
+
+#include <stdint.h>
+
+/**
+ * @brief Rampe entière à pentes montée/descente indépendantes
+ *
+ * La consigne courante est tenue en Q16.16 (Cv × 65536) pour cumuler les
+ * pas fractionnaires sans dérive ; tick() est O(1), sans flottant.
+ */
+class SetpointRamp {
+public:
+    /**
+     * @brief Constructeur (consigne et cible à 0, pentes infinies)
+     */
+    SetpointRamp();
+
+    /**
+     * @brief Définit les pentes
+     *
+     * Une pente nulle signifie « pas de limitation » (saut immédiat).
+     *
+     * @param upPerSecond Pente de montée (Cv/s)
+     * @param downPerSecond Pente de descente (Cv/s)
+     * @param tickMs Période d'appel de tick() (ms)
+     */
+    void setRates(uint16_t upPerSecond, uint16_t downPerSecond, uint16_t tickMs);
+
+    /**
+     * @brief Définit la cible (atteinte progressivement par tick())
+     *
+     * @param target Consigne cible (Cv)
+     */
+    void setTarget(uint16_t target);
+
+    /**
+     * @brief Force consigne et cible (sans rampe)
+     *
+     * @param value Consigne (Cv)
+     */
+    void reset(uint16_t value);
+
+    /**
+     * @brief Avance la rampe d'une période
+     */
+    void tick();
+
+    /**
+     * @brief Consigne cible
+     *
+     * @return Cible (Cv)
+     */
+    uint16_t getTarget() const;
+
+    /**
+     * @brief Consigne courante (rampée), arrondie au Cv le plus proche
+     *
+     * @return Consigne (Cv)
+     */
+    uint16_t getCurrent() const;
+
+    /**
+     * @brief Cible atteinte
+     */
+    bool isSettled() const;
+
+private:
+    uint32_t currentQ16_;  ///< Consigne courante (Q16.16)
+    uint32_t upQ16_;       ///< Pas de montée par tick (Q16.16), 0 = illimité
+    uint32_t downQ16_;     ///< Pas de descente par tick (Q16.16), 0 = illimité
+    uint16_t target_;      ///< Cible (Cv)
+
+    /**
+     * @brief Convertit une pente (Cv/s) en pas par tick (Q16.16)
+     */
+    static uint32_t stepPerTick(uint16_t perSecond, uint16_t tickMs);
+};
+
+#endif // SETPOINT_RAMP_H
@@ -0,0 +1,218 @@
+/**
+ * @file StateJournal.h
+ * @brief Persistance de l'état (mode, consigne, calibration, statistiques)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Journal en mémoire non volatile (Hal::nv*): chaque zone est un anneau
+ * d'emplacements de taille fixe, chaque écriture prend l'emplacement
+ * suivant avec un numéro de séquence incrémenté, l'ancien reste valide
+ * jusqu'à ce que le nouveau soit complet (CRC-32). L'état, écrit le plus
+ * souvent, tourne sur JOURNAL_STATE_SLOTS emplacements ; les statistiques
+ * et chaque courbe de calibration alternent sur deux.
+ *
+ * L'EEPROM émulée du F103 ne fait qu'une page de 1 Ko (vérifié à la
+ * compilation contre E2END, et au démarrage): elle porte l'état et les
+ * statistiques sans leur histogramme par bande. Les courbes (jusqu'à
+ * 1 Ko chacune) vont dans des pages flash dédiées (Hal::page*), chaque
+ * emplacement aligné sur une page et effacé avant d'être réécrit ; sans
+ * ces pages, le journal reste actif mais les courbes ne sont pas
+ * conservées.
+ *
+ * Au démarrage, begin() lit les en-têtes d'un nombre fixe d'emplacements
+ * et retient le plus récent valide par zone: coût borné, indépendant du
+ * nombre d'écritures passées ; les restore*() relisent ensuite ce seul
+ * enregistrement.
+ *
+ * Disposition (octets, depuis l'adresse 0 de chaque zone):
+ *   EEPROM: [état x JOURNAL_STATE_SLOTS][statistiques x 2]
+ *   pages:  [calib. élec. x 2][calib. therm. x 2]
+ * Enregistrement: { magic, taille, séquence, données, CRC-32 }.
+ */
+
+#ifndef STATE_JOURNAL_H
+#define STATE_JOURNAL_H
+
+#include <stdint.h>
+#include "config.h"
+#include "Calibration.h"
+#include "UsageStats.h"
+
+/**
+ * @brief Journal d'état à répartition d'usure
+ */
+class StateJournal {
+public:
+    /**
+     * @brief État opérateur restauré au démarrage
+     */
+    struct State {
+        uint8_t mode;    ///< Mode de vol (PowerDistribution::FlightMode)
+        uint8_t flags;   ///< FLAG_*
+        uint16_t power;  ///< Puissance totale demandée (Cv)
+
+        bool operator==(const State& other) const {
+            return (mode == other.mode) && (flags == other.flags) && (power == other.power);
+        }
+
+        bool operator!=(const State& other) const {
+            return !(*this == other);
+        }
+    };
+
+    /** @brief Compensation du retard turbine active */
+    static constexpr uint8_t FLAG_COMPENSATION = 0x01U;
+
+    /**
+     * @brief Constructeur (journal fermé)
+     */
+    StateJournal();
+
+    /**
+     * @brief Ouvre le stockage et repère le dernier enregistrement de chaque zone
+     *
+     * @return false si le stockage est absent ou trop petit (journal inactif)
+     */
+    bool begin();
+
+    /**
+     * @brief Journal ouvert et utilisable
+     */
+    bool isAvailable() const;
+
+    /**
+     * @brief Pages flash de calibration disponibles (courbes conservées)
+     */
+    bool isCalibrationPersistent() const;
+
+    /**
+     * @brief Dernier état enregistré
+     *
+     * @param state Destination, écrite si un état valide existe
+     * @return true si un état a été restauré
+     */
+    bool restoreState(State* state) const;
+
+    /**
+     * @brief Enregistre l'état (ignoré s'il est identique au dernier)
+     *
+     * @return true si un enregistrement a été écrit (commit() à suivre)
+     */
+    bool saveState(const State& state);
+
+    /**
+     * @brief Recharge les statistiques d'utilisation enregistrées
+     *
+     * @return true si des statistiques ont été restaurées
+     */
+    bool restoreUsage(UsageStats& usage) const;
+
+    /**
+     * @brief Enregistre les statistiques d'utilisation
+     *
+     * @return true si un enregistrement a été écrit (commit() à suivre)
+     */
+    bool saveUsage(const UsageStats& usage);
+
+    /**
+     * @brief Recharge la courbe enregistrée pour la source de la courbe
+     *
+     * @return true si une courbe chargée par série a été restaurée
+     */
+    bool restoreCalibration(CalibrationCurve& curve) const;
+
+    /**
+     * @brief Enregistre la courbe active (le défaut flash est noté sans ses points)
+     *
+     * Écrit directement en flash (effacement bloquant des pages de
+     * l'emplacement), durable au retour.
+     *
+     * @return true si un enregistrement a été écrit
+     */
+    bool saveCalibration(const CalibrationCurve& curve);
+
+    /**
+     * @brief Rend durables les enregistrements écrits (voir Hal::nvCommit())
+     */
+    void commit();
+
+    /**
+     * @brief Numéro de séquence du dernier état (nombre d'états écrits)
+     */
+    uint32_t getStateSequence() const;
+
+    /**
+     * @brief Taille d'EEPROM nécessaire (octets, hors pages de calibration)
+     */
+    static uint32_t requiredSize();
+
+private:
+    /**
+     * @brief Zones du journal (ordre = disposition)
+     */
+    enum Zone : uint8_t {
+        ZONE_STATE = 0U,
+        ZONE_USAGE = 1U,
+        ZONE_CAL_ELECTRIC = 2U,
+        ZONE_CAL_THERMAL = 3U,
+        ZONE_COUNT = 4U
+    };
+
+    /**
+     * @brief Dernier enregistrement valide d'une zone
+     */
+    struct Newest {
+        uint32_t sequence;  ///< Séquence (0 = aucun)
+        uint16_t size;      ///< Taille des données (octets)
+        uint8_t slot;       ///< Emplacement
+    };
+
+    bool available_;              ///< Stockage ouvert et assez grand
+    uint32_t pageStride_;         ///< Pas des emplacements de calibration (octets), 0 sans pages
+    Newest newest_[ZONE_COUNT];   ///< Dernier enregistrement par zone
+    State state_;                 ///< Dernier état enregistré
+
+    /**
+     * @brief Repère le plus récent enregistrement valide d'une zone
+     */
+    void scan(uint8_t zone);
+
+    /**
+     * @brief Zone utilisable (journal ouvert, pages présentes si besoin)
+     */
+    bool zoneAvailable(uint8_t zone) const;
+
+    /**
+     * @brief Distance entre deux emplacements d'une zone (octets)
+     */
+    uint32_t slotStride(uint8_t zone) const;
+
+    /**
+     * @brief Adresse d'un emplacement dans sa zone (EEPROM ou pages)
+     */
+    uint32_t slotOffset(uint8_t zone, uint8_t slot) const;
+
+    /**
+     * @brief Adresse des données du plus récent enregistrement d'une zone
+     */
+    uint32_t dataOffset(uint8_t zone) const;
+
+    /**
+     * @brief Écrit l'en-tête dans l'emplacement suivant
+     *
+     * @return Adresse des données
+     */
+    uint32_t beginRecord(uint8_t zone, uint16_t size, uint32_t* crc);
+
+    /**
+     * @brief Écrit une partie des données et cumule le CRC
+     */
+    void writePart(uint8_t zone, uint32_t* offset, const void* data, uint16_t size, uint32_t* crc);
+
+    /**
+     * @brief Écrit le CRC et fait de l'enregistrement le plus récent
+     */
+    void endRecord(uint8_t zone, uint32_t offset, uint16_t size, uint32_t crc);
+};
+
+#endif // STATE_JOURNAL_H
@@ -0,0 +1,63 @@
+/**
+ * @file TurbineSpool.h
+ * @brief Modèle de réponse de la turbine (retard d'attelage, 1er ordre)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#ifndef TURBINE_SPOOL_H
+#define TURBINE_SPOOL_H
+
+#include <stdint.h>
+
+/**
+ * @brief Estimation de la puissance thermique réellement délivrée
+ *
+ * Filtre du premier ordre discrétisé (Euler implicite, stable pour toute
+ * constante de temps) : p += (consigne - p) × dt / (tau + dt).
+ * État en Q16.16 non signé (toute consigne uint16_t, 0xFFFF0000 au
+ * plus), gain en Q16 précalculé ; tick() coûte une multiplication
+ * 32x32→64, sans flottant.
+ */
+class TurbineSpool {
+public:
+    /**
+     * @brief Constructeur (délivré à 0, réponse immédiate)
+     */
+    TurbineSpool();
+
+    /**
+     * @brief Définit la constante de temps
+     *
+     * @param tauMs Constante de temps (ms, 0 = réponse immédiate)
+     * @param tickMs Période d'appel de tick() (ms)
+     */
+    void setTimeConstant(uint16_t tauMs, uint16_t tickMs);
+
+    /**
+     * @brief Force la puissance délivrée (régime établi)
+     *
+     * @param value Puissance délivrée (Cv)
+     */
+    void reset(uint16_t value);
+
+    /**
+     * @brief Avance le modèle d'une période
+     *
+     * @param commanded Consigne thermique appliquée (Cv)
+     */
+    void tick(uint16_t commanded);
+
+    /**
+     * @brief Puissance thermique délivrée estimée (arrondie)
+     *
+     * @return Puissance (Cv)
+     */
+    uint16_t getDelivered() const;
+
+private:
+    uint32_t delivered_; ///< Puissance délivrée (Cv, Q16.16)
+    int32_t gain_;       ///< dt / (tau + dt) en Q16 (65536 = immédiat)
+};
+
+#endif // TURBINE_SPOOL_H
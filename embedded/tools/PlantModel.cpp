@@ -0,0 +1,123 @@
+/**
+ * @file PlantModel.cpp
+ * @brief Implémentation du procédé simulé (host)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ */
+
+#include "PlantModel.h"
+#include <math.h>
+#include "config.h"
+#include "PowerUnits.h"
+
+// ============================================================================
+// PARAMÈTRES
+// ============================================================================
+
+PlantModel::Params PlantModel::defaultParams() {
+    Params params;
+
+    // 1000 Cv électriques = 22 kW à ~200 rad/s → ~110 N·m, ~110 A
+    params.motorKt = 1.0F;
+    params.motorResistance = 0.05F;
+    params.motorInductance = 0.0005F;
+    params.motorCurrentMax = 150.0F;
+    params.busVoltage = static_cast<float>(BATTERY_VOLTAGE_FULL_MV) / 1000.0F;
+
+    // Plein régime = plafond thermique URGENCE
+    params.turbinePowerMax = static_cast<float>(PowerUnits::cvToWatts(UrgenceConfig::THERMAL_MAX));
+    params.spoolTauHigh = static_cast<float>(TURBINE_SPOOL_TAU_MS) / 1000.0F;
+    params.spoolTauIdle = 2.0F * params.spoolTauHigh;
+    params.spoolRateMax = 0.5F;
+
+    // Charge hélice: 3750 Cv (82,5 kW) absorbés à 200 rad/s
+    params.shaftInertia = 2.0F;
+    params.propellerLoad = static_cast<float>(PowerUnits::cvToWatts(UrgenceConfig::MAX_POWER)) / (200.0F * 200.0F * 200.0F);
+    params.omegaMin = 20.0F;
+
+    return params;
+}
+
+// ============================================================================
+// CONSTRUCTEUR
+// ============================================================================
+
+PlantModel::PlantModel(const Params& params)
+    : params_(params)
+    , currentAlpha_(1.0F - expf(-STEP * params.motorResistance / params.motorInductance))
+    , stepOverInertia_(STEP / params.shaftInertia)
+    , inverseKt_(1.0F / params.motorKt)
+    , inverseResistance_(1.0F / params.motorResistance)
+    , inversePowerMax_(1.0F / params.turbinePowerMax)
+    , spoolRateHigh_(STEP / params.spoolTauHigh)
+    , spoolRateIdle_(STEP / params.spoolTauIdle)
+{
+}
+
+void PlantModel::reset(State& state, float electricW, float thermalW) const {
+    // Vitesse d'équilibre: P = k·ω³
+    const float total = electricW + thermalW;
+    const float omega = cbrtf(total / params_.propellerLoad);
+
+    state.omega = (omega > params_.omegaMin) ? omega : params_.omegaMin;
+    state.current = electricW / (params_.motorKt * state.omega);
+    state.spool = thermalW / params_.turbinePowerMax;
+    state.electricCmd = electricW;
+    state.thermalCmd = thermalW;
+}
+
+// ============================================================================
+// PAS D'INTÉGRATION
+// ============================================================================
+
+void PlantModel::step(State& state) const {
+    const float omega = (state.omega > params_.omegaMin) ? state.omega : params_.omegaMin;
+    const float inverseOmega = 1.0F / omega;
+
+    // PMSM: courant de référence borné par Imax et par la tension bus
+    float reference = state.electricCmd * inverseKt_ * inverseOmega;
+    const float voltageLimit = (params_.busVoltage - params_.motorKt * state.omega) * inverseResistance_;
+    reference = (reference < params_.motorCurrentMax) ? reference : params_.motorCurrentMax;
+    reference = (reference < voltageLimit) ? reference : voltageLimit;
+    reference = (reference > 0.0F) ? reference : 0.0F;
+    state.current += (reference - state.current) * currentAlpha_;
+    // Pas de dénormaux quand le courant s'éteint (coût ×100 sur x86)
+    state.current = (state.current > 1.0e-6F) ? state.current : 0.0F;
+
+    // Turbine: 1er ordre à constante de temps variable, accélération bornée
+    float demand = state.thermalCmd * inversePowerMax_;
+    demand = (demand < 1.0F) ? ((demand > 0.0F) ? demand : 0.0F) : 1.0F;
+    // (1/tau interpolé entre ralenti et plein régime: pas de division)
+    const float rate = spoolRateHigh_ + (spoolRateIdle_ - spoolRateHigh_) * (1.0F - state.spool);
+    const float rateMax = params_.spoolRateMax * STEP;
+    float delta = (demand - state.spool) * rate;
+    delta = (delta < rateMax) ? ((delta > -rateMax) ? delta : -rateMax) : rateMax;
+    state.spool += delta;
+
+    // Arbre commun
+    const float torque = params_.motorKt * state.current
+                       + state.spool * params_.turbinePowerMax * inverseOmega
+                       - params_.propellerLoad * state.omega * state.omega;
+    state.omega += torque * stepOverInertia_;
+    state.omega = (state.omega > 0.0F) ? state.omega : 0.0F;
+}
+
+void PlantModel::advance(State& state, uint32_t steps) const {
+    // Boucle dans cette unité: l'état reste en registres entre les pas
+    for (uint32_t i = 0U; i < steps; i++) {
+        step(state);
+    }
+}
+
+// ============================================================================
+// MESURES
+// ============================================================================
+
+float PlantModel::electricPower(const State& state) const {
+    return params_.motorKt * state.current * state.omega;
+}
+
+float PlantModel::thermalPower(const State& state) const {
+    const float omega = (state.omega > params_.omegaMin) ? state.omega : params_.omegaMin;
+    return (state.spool * params_.turbinePowerMax) * (state.omega / omega);
+}
@@ -0,0 +1,116 @@
+/**
+ * @file PlantModel.h
+ * @brief Procédé simulé (host) : moteur électrique PMSM, turbopropulseur, arbre
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Modèle à pas fixe de 1 ms pour le réglage et la non-régression sur PC.
+ * Paramètres (froids, partagés) et état (chaud, 5 floats) sont séparés :
+ * step() ne touche qu'un état compact, sans allocation ni branche
+ * coûteuse, pour simuler des vols entiers en quelques millisecondes.
+ */
+
+#ifndef PLANT_MODEL_H
+#define PLANT_MODEL_H
+
+#include <stdint.h>
+
+/**
+ * @brief Moteur PMSM + turbine + arbre d'hélice commun
+ *
+ * - PMSM (repère dq réduit à l'axe q): courant de référence = P / (Kt·ω),
+ *   borné par Imax et par la tension bus (fcém Ke·ω + R·i) ; dynamique
+ *   électrique du 1er ordre L/R.
+ * - Turbine: régime générateur normalisé, 1er ordre dont l'inverse de la
+ *   constante de temps varie linéairement du ralenti (lent) au plein
+ *   régime, accélération bornée ; puissance arbre proportionnelle au régime.
+ * - Arbre: J·dω/dt = Te + Tt - k·ω² (charge hélice).
+ */
+class PlantModel {
+public:
+    /**
+     * @brief Paramètres physiques
+     */
+    struct Params {
+        float motorKt;              ///< Constante de couple = fcém (N·m/A, V·s/rad)
+        float motorResistance;      ///< Résistance de phase (Ω)
+        float motorInductance;      ///< Inductance q (H)
+        float motorCurrentMax;      ///< Courant maximal (A)
+        float busVoltage;           ///< Tension bus DC (V)
+        float turbinePowerMax;      ///< Puissance arbre à plein régime (W)
+        float spoolTauHigh;         ///< Constante de temps à plein régime (s)
+        float spoolTauIdle;         ///< Constante de temps au ralenti (s)
+        float spoolRateMax;         ///< Accélération de régime maximale (1/s)
+        float shaftInertia;         ///< Inertie ramenée à l'arbre (kg·m²)
+        float propellerLoad;        ///< Coefficient de charge hélice k (N·m·s²)
+        float omegaMin;             ///< Vitesse plancher pour le calcul de couple (rad/s)
+    };
+
+    /**
+     * @brief État dynamique (chaud)
+     */
+    struct State {
+        float current;       ///< Courant q (A)
+        float spool;         ///< Régime turbine normalisé [0, 1]
+        float omega;         ///< Vitesse arbre (rad/s)
+        float electricCmd;   ///< Commande électrique appliquée (W)
+        float thermalCmd;    ///< Commande thermique appliquée (W)
+    };
+
+    /** @brief Pas d'intégration (s) */
+    static constexpr float STEP = 0.001F;
+
+    /**
+     * @brief Paramètres par défaut à l'échelle du démonstrateur (1 Cv = 22 W)
+     */
+    static Params defaultParams();
+
+    /**
+     * @brief Constructeur: précalcule les coefficients par pas
+     */
+    explicit PlantModel(const Params& params);
+
+    /**
+     * @brief Régime établi pour une commande donnée
+     *
+     * @param state État initialisé
+     * @param electricW Puissance électrique (W)
+     * @param thermalW Puissance thermique (W)
+     */
+    void reset(State& state, float electricW, float thermalW) const;
+
+    /**
+     * @brief Avance le procédé d'un pas (1 ms)
+     */
+    void step(State& state) const;
+
+    /**
+     * @brief Avance le procédé de plusieurs pas à commande constante
+     *
+     * @param state État
+     * @param steps Nombre de pas de 1 ms
+     */
+    void advance(State& state, uint32_t steps) const;
+
+    /**
+     * @brief Puissance électrique délivrée à l'arbre (W)
+     */
+    float electricPower(const State& state) const;
+
+    /**
+     * @brief Puissance thermique délivrée à l'arbre (W)
+     */
+    float thermalPower(const State& state) const;
+
+private:
+    Params params_;            ///< Paramètres physiques
+    float currentAlpha_;       ///< 1 - exp(-STEP·R/L)
+    float stepOverInertia_;    ///< STEP / J
+    float inverseKt_;          ///< 1 / Kt
+    float inverseResistance_;  ///< 1 / R
+    float inversePowerMax_;    ///< 1 / puissance turbine maximale
+    float spoolRateHigh_;      ///< STEP / tau à plein régime
+    float spoolRateIdle_;      ///< STEP / tau au ralenti
+};
+
+#endif // PLANT_MODEL_H
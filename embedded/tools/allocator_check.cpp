@@ -0,0 +1,271 @@
+/**
+ * @file allocator_check.cpp
+ * @brief Équivalence PowerAllocator / anciennes fonctions par mode (host)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC, trois parties:
+ * 1. Équivalence: PowerDistribution::calculate() sur les 65536 demandes de
+ *    chaque mode (et un mode inconnu) contre une copie des fonctions
+ *    calculateDecollage / calculateNormal / calculateUrgence remplacées
+ *    par l'allocateur générique (limites config.h, sans limite batterie).
+ * 2. Profils quelconques: allocate() contre un remplissage séquentiel
+ *    (boucle avec branchements) sur des profils tirés au hasard, 1 à 4
+ *    étages, minimums non nuls.
+ * 3. configure(): profils invalides refusés sans modifier le profil en
+ *    place (source hors plage, dupliquée, min > max, trop d'étages,
+ *    capacité > 65535 Cv).
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -I../PowerManagement allocator_check.cpp \
+ *       ../PowerManagement/PowerDistribution.cpp ../PowerManagement/PowerAllocator.cpp \
+ *       ../PowerManagement/ModeLimits.cpp ../PowerManagement/Crc.cpp -o allocator_check
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "config.h"
+#include "PowerDistribution.h"
+#include "PowerAllocator.h"
+
+namespace {
+
+    typedef PowerDistribution::FlightMode Mode;
+    typedef PowerDistribution::PowerOutput Output;
+
+    int failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            printf("ECHEC %s\n", what);
+            failures++;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Fonctions par mode d'origine (avant PowerAllocator)
+    // ------------------------------------------------------------------------
+
+    uint16_t legacyMin(uint16_t a, uint16_t b) {
+        return (a < b) ? a : b;
+    }
+
+    Output legacyDecollage(uint16_t totalPower) {
+        Output output;
+        output.electric = legacyMin(totalPower, DecollageConfig::ELECTRIC_MAX);
+        uint16_t remaining = 0U;
+        if (totalPower > output.electric) {
+            remaining = totalPower - output.electric;
+        }
+        output.thermal = legacyMin(remaining, DecollageConfig::THERMAL_MAX);
+        output.total = output.electric + output.thermal;
+        return output;
+    }
+
+    Output legacyNormal(uint16_t totalPower) {
+        Output output;
+        output.electric = 0U;
+        output.thermal = legacyMin(totalPower, NormalConfig::THERMAL_MAX);
+        output.total = output.thermal;
+        return output;
+    }
+
+    Output legacyUrgence(uint16_t totalPower) {
+        Output output;
+        output.electric = legacyMin(totalPower, UrgenceConfig::ELECTRIC_MAX);
+        uint16_t remaining = 0U;
+        if (totalPower > output.electric) {
+            remaining = totalPower - output.electric;
+        }
+        output.thermal = legacyMin(remaining, UrgenceConfig::THERMAL_MAX);
+        output.total = output.electric + output.thermal;
+        return output;
+    }
+
+    Output legacyCalculate(Mode mode, uint16_t totalPower) {
+        switch (mode) {
+            case Mode::DECOLLAGE:
+                return legacyDecollage(totalPower);
+            case Mode::NORMAL:
+                return legacyNormal(totalPower);
+            case Mode::URGENCE:
+                return legacyUrgence(totalPower);
+            default:
+                return legacyNormal(totalPower);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Référence séquentielle pour un profil quelconque
+    // ------------------------------------------------------------------------
+
+    PowerAllocator::Allocation sequential(const PowerAllocator::Stage* stages, uint8_t count, uint16_t demand) {
+        PowerAllocator::Allocation output = {};
+        uint32_t minTotal = 0U;
+        for (uint8_t i = 0U; i < count; i++) {
+            minTotal += stages[i].min;
+        }
+
+        uint32_t remaining = (demand > minTotal) ? (demand - minTotal) : 0U;
+        for (uint8_t i = 0U; i < count; i++) {
+            const uint32_t room = stages[i].max - stages[i].min;
+            const uint32_t extra = (remaining < room) ? remaining : room;
+            output.power[static_cast<uint8_t>(stages[i].source)] = static_cast<uint16_t>(stages[i].min + extra);
+            output.total = static_cast<uint16_t>(output.total + stages[i].min + extra);
+            remaining -= extra;
+        }
+        return output;
+    }
+
+    bool sameAllocation(const PowerAllocator::Allocation& a, const PowerAllocator::Allocation& b) {
+        for (uint8_t s = 0U; s < PowerAllocator::SOURCE_COUNT; s++) {
+            if (a.power[s] != b.power[s]) {
+                return false;
+            }
+        }
+        return a.total == b.total;
+    }
+
+    uint32_t lcg = 2026U;
+
+    uint32_t next(uint32_t range) {
+        lcg = lcg * 1103515245U + 12345U;
+        return (lcg >> 8) % range;
+    }
+}
+
+int main() {
+    // ------------------------------------------------------------------------
+    // 1. Équivalence avec les fonctions par mode
+    // ------------------------------------------------------------------------
+    const PowerDistribution distribution;
+    const struct {
+        Mode mode;
+        const char* name;
+    } modes[] = {
+        { Mode::DECOLLAGE, "DECOLLAGE" },
+        { Mode::NORMAL, "NORMAL" },
+        { Mode::URGENCE, "URGENCE" },
+        { static_cast<Mode>(3U), "inconnu (3)" },
+        { static_cast<Mode>(255U), "inconnu (255)" }
+    };
+
+    printf("Équivalence (65536 demandes par mode)\n");
+    printf("  %-14s %9s %9s %9s\n", "mode", "écarts", "max élec", "max therm");
+    for (const auto& m : modes) {
+        uint32_t mismatches = 0U;
+        uint16_t electricMax = 0U;
+        uint16_t thermalMax = 0U;
+
+        for (uint32_t demand = 0U; demand <= 0xFFFFU; demand++) {
+            const Output expected = legacyCalculate(m.mode, static_cast<uint16_t>(demand));
+            const Output actual = distribution.calculate(m.mode, static_cast<uint16_t>(demand));
+
+            if (actual.electric != expected.electric || actual.thermal != expected.thermal
+                || actual.total != expected.total) {
+                if (mismatches++ < 5U) {
+                    printf("ECHEC %s demande %u: %u/%u/%u, attendu %u/%u/%u\n", m.name, demand,
+                           actual.electric, actual.thermal, actual.total,
+                           expected.electric, expected.thermal, expected.total);
+                }
+            }
+            electricMax = (actual.electric > electricMax) ? actual.electric : electricMax;
+            thermalMax = (actual.thermal > thermalMax) ? actual.thermal : thermalMax;
+        }
+
+        failures += (mismatches != 0U) ? 1 : 0;
+        printf("  %-14s %8u %8u %9u\n", m.name, mismatches, electricMax, thermalMax);
+    }
+
+    // ------------------------------------------------------------------------
+    // 2. Profils quelconques contre le remplissage séquentiel
+    // ------------------------------------------------------------------------
+    const uint32_t profiles = 2000U;
+    uint32_t profileMismatches = 0U;
+
+    for (uint32_t p = 0U; p < profiles; p++) {
+        PowerAllocator::Stage stages[POWER_ALLOCATOR_MAX_STAGES];
+        PowerAllocator::Source order[PowerAllocator::SOURCE_COUNT] = {
+            PowerAllocator::Source::ELECTRIC, PowerAllocator::Source::THERMAL,
+            PowerAllocator::Source::APU, PowerAllocator::Source::BATTERY_BOOST
+        };
+        const uint8_t count = static_cast<uint8_t>(1U + next(POWER_ALLOCATOR_MAX_STAGES));
+
+        for (uint8_t i = 0U; i < count; i++) {
+            const uint8_t pick = static_cast<uint8_t>(i + next(PowerAllocator::SOURCE_COUNT - i));
+            const PowerAllocator::Source source = order[pick];
+            order[pick] = order[i];
+            order[i] = source;
+
+            const uint16_t max = static_cast<uint16_t>(next(16000U));
+            const uint16_t min = static_cast<uint16_t>((next(4U) == 0U) ? next(max + 1U) : 0U);
+            stages[i] = { source, min, max };
+        }
+
+        PowerAllocator allocator;
+        if (!allocator.configure(stages, count)) {
+            printf("ECHEC profil valide refusé\n");
+            failures++;
+            continue;
+        }
+
+        for (uint32_t demand = 0U; demand <= 0xFFFFU; demand += 1U + next(64U)) {
+            const uint16_t d = static_cast<uint16_t>(demand);
+            if (!sameAllocation(allocator.allocate(d), sequential(stages, count, d))) {
+                profileMismatches++;
+            }
+        }
+    }
+    failures += (profileMismatches != 0U) ? 1 : 0;
+    printf("\nProfils aléatoires: %u profils, %u écarts\n", profiles, profileMismatches);
+
+    // ------------------------------------------------------------------------
+    // 3. Profils invalides
+    // ------------------------------------------------------------------------
+    {
+        PowerAllocator allocator;
+        const PowerAllocator::Stage valid[] = {
+            { PowerAllocator::Source::ELECTRIC, 0U, 1000U },
+            { PowerAllocator::Source::THERMAL, 0U, 2000U }
+        };
+        check(allocator.configure(valid, 2U), "profil de référence accepté");
+
+        const PowerAllocator::Stage outOfRange[] = {
+            { PowerAllocator::Source::THERMAL, 0U, 100U },
+            { static_cast<PowerAllocator::Source>(200U), 0U, 100U }
+        };
+        const PowerAllocator::Stage countSource[] = {
+            { PowerAllocator::Source::COUNT, 0U, 100U }
+        };
+        const PowerAllocator::Stage duplicate[] = {
+            { PowerAllocator::Source::THERMAL, 0U, 100U },
+            { PowerAllocator::Source::THERMAL, 0U, 100U }
+        };
+        const PowerAllocator::Stage inverted[] = {
+            { PowerAllocator::Source::APU, 200U, 100U }
+        };
+        const PowerAllocator::Stage overflow[] = {
+            { PowerAllocator::Source::ELECTRIC, 0U, 40000U },
+            { PowerAllocator::Source::THERMAL, 0U, 30000U }
+        };
+        const PowerAllocator::Stage tooMany[POWER_ALLOCATOR_MAX_STAGES + 1U] = {};
+
+        check(!allocator.configure(outOfRange, 2U), "source 200 refusée");
+        check(!allocator.configure(countSource, 1U), "source COUNT refusée");
+        check(!allocator.configure(duplicate, 2U), "source dupliquée refusée");
+        check(!allocator.configure(inverted, 1U), "min > max refusé");
+        check(!allocator.configure(overflow, 2U), "capacité > 65535 refusée");
+        check(!allocator.configure(tooMany, POWER_ALLOCATOR_MAX_STAGES + 1U), "trop d'étages refusé");
+        check(allocator.getCapacity() == 3000U && allocator.allocate(1500U).power[0] == 1000U,
+              "profil inchangé après refus");
+        printf("Profils invalides: 6 refusés, profil en place conservé\n");
+    }
+
+    if (failures != 0) {
+        printf("\n%d ECHEC(S)\n", failures);
+        return 1;
+    }
+
+    printf("\nOK\n");
+    return 0;
+}
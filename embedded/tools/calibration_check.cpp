@@ -0,0 +1,209 @@
+/**
+ * @file calibration_check.cpp
+ * @brief Vérification exhaustive de l'interpolation CalibrationCurve (host)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC, deux parties:
+ * 1. Interpolation: toWatts() sur les 65536 demandes, comparé à une
+ *    référence 64 bits (arrondi demi vers +∞), pour les courbes par défaut
+ *    (= PowerUnits::cvToWatts jusqu'à 4096 Cv), pas 2^0 à 257 points, pas
+ *    2^12 à écart maximal, et la courbe d'exemple de la documentation.
+ *    Points de grille exacts, plat au-delà du dernier point.
+ * 2. Chargement: paramètres et points invalides, chargement incomplet ou
+ *    interrompu par l'autre source ; la courbe active ne change qu'à
+ *    commitLoad().
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -I../PowerManagement calibration_check.cpp \
+ *       ../PowerManagement/Calibration.cpp -o calibration_check
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "Calibration.h"
+#include "PowerUnits.h"
+
+namespace {
+
+    int failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            printf("ECHEC %s\n", what);
+            failures++;
+        }
+    }
+
+    /**
+     * @brief Charge une courbe complète
+     */
+    bool load(CalibrationCurve& curve, uint8_t shift, const uint32_t* points, uint16_t count) {
+        if (!curve.beginLoad(shift, count)) {
+            return false;
+        }
+        for (uint16_t i = 0U; i < count; i++) {
+            if (!curve.appendPoint(points[i])) {
+                return false;
+            }
+        }
+        return curve.commitLoad();
+    }
+
+    /**
+     * @brief Valeur attendue (64 bits, arrondi demi vers +∞, plat en fin)
+     */
+    uint32_t reference(const uint32_t* points, uint16_t count, uint8_t shift, uint16_t cv) {
+        const uint32_t index = static_cast<uint32_t>(cv) >> shift;
+        if (index >= static_cast<uint32_t>(count - 1U)) {
+            return points[count - 1U];
+        }
+
+        const uint64_t step = 1ULL << shift;
+        const uint64_t frac = cv - (index << shift);
+        const uint64_t scaled = points[index] * (step - frac) + points[index + 1U] * frac;
+        return static_cast<uint32_t>((scaled + step / 2U) / step);
+    }
+
+    /**
+     * @brief Compare toWatts() à la référence sur tout le domaine
+     */
+    void sweep(const char* label, const CalibrationCurve& curve,
+               const uint32_t* points, uint16_t count, uint8_t shift) {
+        uint32_t mismatches = 0U;
+        uint32_t gridHits = 0U;
+
+        for (uint32_t cv = 0U; cv <= 0xFFFFU; cv++) {
+            const uint16_t demand = static_cast<uint16_t>(cv);
+            const uint32_t expected = reference(points, count, shift, demand);
+            const uint32_t actual = curve.toWatts(demand);
+
+            if (actual != expected) {
+                if (mismatches++ < 5U) {
+                    printf("ECHEC %s toWatts(%u) = %u, attendu %u\n", label, cv, actual, expected);
+                }
+            }
+            if ((cv & ((1UL << shift) - 1U)) == 0U && (cv >> shift) < count) {
+                gridHits += (actual == points[cv >> shift]) ? 1U : 0U;
+            }
+        }
+
+        const uint32_t gridPoints = ((0xFFFFUL >> shift) + 1U < count) ? (0xFFFFUL >> shift) + 1U : count;
+        check(gridHits == gridPoints, "points de grille exacts");
+        check(curve.toWatts(0xFFFFU) == reference(points, count, shift, 0xFFFFU), "fin de domaine");
+        failures += (mismatches != 0U) ? 1 : 0;
+
+        printf("  %5u %6u %10u %10u %8u  %s\n", count, 1U << shift,
+               points[count - 1U], curve.toWatts(0xFFFFU), mismatches, label);
+    }
+}
+
+int main() {
+    static uint32_t points[CALIBRATION_MAX_POINTS];
+
+    // ------------------------------------------------------------------------
+    // 1. Interpolation
+    // ------------------------------------------------------------------------
+    printf("Interpolation (65536 demandes par courbe)\n");
+    printf("  %5s %6s %10s %10s %8s  %s\n", "pts", "pas", "dernier W", "W(65535)", "écarts", "courbe");
+
+    {
+        // Défaut flash: linéaire 22 W/Cv jusqu'à 4096 Cv, plat au-delà
+        CalibrationCurve electric(CalibrationCurve::Source::ELECTRIC);
+        CalibrationCurve thermal(CalibrationCurve::Source::THERMAL);
+        const uint32_t defaults[] = { 0UL, electric.getPoint(1U) };
+        sweep("défaut électrique", electric, defaults, 2U, electric.getShift());
+        sweep("défaut thermique", thermal, defaults, 2U, thermal.getShift());
+
+        uint32_t linear = 0U;
+        for (uint32_t cv = 0U; cv <= 4096U; cv++) {
+            const uint16_t demand = static_cast<uint16_t>(cv);
+            linear += (electric.toWatts(demand) == PowerUnits::cvToWatts(demand)) ? 1U : 0U;
+        }
+        check(linear == 4097U, "défaut = PowerUnits::cvToWatts jusqu'à 4096 Cv");
+        check(electric.isDefault() && thermal.isDefault(), "courbes par défaut actives");
+    }
+
+    {
+        // Pas 2^0: 257 points, dernier point à 256 Cv, plat au-delà
+        CalibrationCurve curve(CalibrationCurve::Source::ELECTRIC);
+        uint32_t lcg = 12345U;
+        points[0] = 0U;
+        for (uint16_t i = 1U; i < CALIBRATION_MAX_POINTS; i++) {
+            lcg = lcg * 1103515245U + 12345U;
+            points[i] = points[i - 1U] + ((lcg >> 8) % 60000U);
+        }
+        check(load(curve, 0U, points, CALIBRATION_MAX_POINTS), "pas 1 Cv, 257 points accepté");
+        sweep("pas 2^0, 257 points", curve, points, CALIBRATION_MAX_POINTS, 0U);
+    }
+
+    {
+        // Pas 2^12: 17 points, écart maximal accepté (int32 à la limite)
+        CalibrationCurve curve(CalibrationCurve::Source::THERMAL);
+        const uint32_t maxDelta = 0x7FFFFFFFUL >> CALIBRATION_MAX_SHIFT;
+        for (uint16_t i = 0U; i < 17U; i++) {
+            points[i] = i * maxDelta;
+        }
+        check(load(curve, CALIBRATION_MAX_SHIFT, points, 17U), "pas 4096 Cv, écart maximal accepté");
+        sweep("pas 2^12, écart max", curve, points, 17U, CALIBRATION_MAX_SHIFT);
+    }
+
+    {
+        // Exemple de la documentation: c 1 6 4 0 1000 3000 7000
+        CalibrationCurve curve(CalibrationCurve::Source::THERMAL);
+        const uint32_t example[] = { 0UL, 1000UL, 3000UL, 7000UL };
+        check(load(curve, 6U, example, 4U), "exemple accepté");
+        sweep("exemple c 1 6 4", curve, example, 4U, 6U);
+        check(curve.toWatts(192U) == 7000U && curve.toWatts(191U) == 6938U, "dernier point et segment final");
+    }
+
+    // ------------------------------------------------------------------------
+    // 2. Chargement
+    // ------------------------------------------------------------------------
+    printf("\nChargement\n");
+    {
+        CalibrationCurve electric(CalibrationCurve::Source::ELECTRIC);
+        CalibrationCurve thermal(CalibrationCurve::Source::THERMAL);
+        const uint32_t example[] = { 0UL, 1000UL, 3000UL, 7000UL };
+
+        check(load(electric, 6U, example, 4U), "courbe chargée");
+        const uint16_t revision = electric.getRevision();
+        const uint32_t before = electric.toWatts(100U);
+
+        check(!electric.beginLoad(CALIBRATION_MAX_SHIFT + 1U, 4U), "pas trop grand refusé");
+        check(!electric.beginLoad(6U, 1U), "un seul point refusé");
+        check(!electric.beginLoad(6U, CALIBRATION_MAX_POINTS + 1U), "trop de points refusé");
+
+        check(electric.beginLoad(6U, 3U) && electric.appendPoint(500U), "chargement démarré");
+        check(!electric.appendPoint(400U), "point décroissant refusé");
+        check(!electric.commitLoad(), "chargement rejeté non activé");
+
+        check(electric.beginLoad(4U, 3U) && electric.appendPoint(0U), "chargement démarré (pas 16)");
+        check(!electric.appendPoint((0x7FFFFFFFUL >> 4) + 1U), "écart hors int32 refusé");
+
+        check(electric.beginLoad(6U, 3U) && electric.appendPoint(0U) && electric.appendPoint(10U), "chargement partiel");
+        check(!electric.commitLoad(), "chargement incomplet refusé");
+
+        check(electric.beginLoad(6U, 2U) && electric.appendPoint(0U), "chargement électrique démarré");
+        check(thermal.beginLoad(6U, 2U), "chargement thermique démarré");
+        check(!electric.appendPoint(10U) && !electric.commitLoad(), "chargement interrompu par l'autre source");
+        check(thermal.appendPoint(0U) && thermal.appendPoint(10U) && thermal.commitLoad(), "chargement thermique activé");
+
+        check(!electric.isDefault() && electric.getCount() == 4U && electric.getStep() == 64U
+              && electric.toWatts(100U) == before && electric.getRevision() == revision,
+              "courbe active intacte après rejets");
+        printf("  après rejets: courbe active %u points, pas %u Cv, W(100) = %u\n",
+               electric.getCount(), electric.getStep(), electric.toWatts(100U));
+
+        check(load(electric, 8U, example, 3U) && electric.getRevision() != revision
+              && electric.getCount() == 3U, "nouvelle courbe activée, révision avancée");
+    }
+
+    if (failures != 0) {
+        printf("\n%d ECHEC(S)\n", failures);
+        return 1;
+    }
+
+    printf("\nOK\n");
+    return 0;
+}
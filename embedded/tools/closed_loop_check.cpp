@@ -0,0 +1,171 @@
+/**
+ * @file closed_loop_check.cpp
+ * @brief Boucle fermée PowerLoop contre un procédé simulé : réponse et coût
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC: branche sur PowerLoop des capteurs lisant un procédé simple du
+ * premier ordre par source (gain statique < 1 pour exercer l'intégrale),
+ * applique des échelons de consigne à plusieurs cadences de contrôle et
+ * affiche temps d'établissement, dépassement et erreur statique, puis le
+ * coût d'un tick de régulation.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -I../PowerManagement closed_loop_check.cpp \
+ *       ../PowerManagement/PowerLoop.cpp ../PowerManagement/PidController.cpp \
+ *       ../PowerManagement/PowerDistribution.cpp ../PowerManagement/PowerAllocator.cpp \
+ *       ../PowerManagement/ModeLimits.cpp ../PowerManagement/Crc.cpp \
+ *       -o closed_loop_check
+ *
+ * Sur cible, mesurer le même tick avec DWT->CYCCNT : le budget reste
+ * tick × fréquence ≪ temps laissé à la liaison série.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+#include "config.h"
+#include "PowerLoop.h"
+
+namespace {
+
+    /**
+     * @brief Procédé du premier ordre (hôte, flottant)
+     */
+    struct Plant {
+        double gain;      ///< Gain statique (puissance délivrée / commande)
+        double tauMs;     ///< Constante de temps (ms)
+        double output;    ///< Puissance délivrée (Cv)
+    };
+
+    /** @brief Procédés électrique (rapide) et thermique (lent) */
+    Plant plants[PowerLoop::LOOP_COUNT];
+
+    /**
+     * @brief Capteur simulé: lit la sortie du procédé
+     */
+    bool readPlant(PowerAllocator::Source source, uint16_t* power) {
+        const double value = plants[static_cast<uint8_t>(source)].output;
+        *power = static_cast<uint16_t>((value < 0.0) ? 0.0 : (value + 0.5));
+        return true;
+    }
+
+    /**
+     * @brief Avance les procédés d'une période, pas de 1 ms
+     */
+    void stepPlants(const PowerDistribution::PowerOutput& command, uint16_t tickMs) {
+        const double input[PowerLoop::LOOP_COUNT] = {
+            static_cast<double>(command.electric), static_cast<double>(command.thermal)
+        };
+
+        for (uint16_t ms = 0U; ms < tickMs; ms++) {
+            for (uint8_t i = 0U; i < PowerLoop::LOOP_COUNT; i++) {
+                Plant& plant = plants[i];
+                plant.output += (plant.gain * input[i] - plant.output) / plant.tauMs;
+            }
+        }
+    }
+
+    /**
+     * @brief Applique un échelon et simule jusqu'à établissement
+     *
+     * @return Erreur statique finale de la source (Cv)
+     */
+    int32_t runStep(PowerLoop& loop, PowerAllocator::Source source, uint16_t target,
+                    uint16_t tickMs, bool closed) {
+        plants[0] = { 0.95, 20.0, 0.0 };
+        plants[1] = { 0.92, TURBINE_SPOOL_TAU_MS, 0.0 };
+
+        loop.setSensor(PowerAllocator::Source::ELECTRIC, closed ? readPlant : nullptr);
+        loop.setSensor(PowerAllocator::Source::THERMAL, closed ? readPlant : nullptr);
+
+        PowerDistribution::PowerOutput setpoint = { 0U, 0U, 0U };
+        if (source == PowerAllocator::Source::ELECTRIC) {
+            setpoint.electric = target;
+        } else {
+            setpoint.thermal = target;
+        }
+
+        // 20 s simulées
+        for (uint32_t t = 0U; t < 20000U; t += tickMs) {
+            loop.tick(setpoint);
+            stepPlants(loop.getCommand(), tickMs);
+        }
+
+        uint16_t measured = 0U;
+        readPlant(source, &measured);
+        return static_cast<int32_t>(measured) - static_cast<int32_t>(target);
+    }
+}
+
+int main() {
+    int failures = 0;
+    const uint16_t rates[] = { 50U, 20U, 10U, 5U };
+
+    printf("Échelons 0 → consigne, 20 s simulées, bande ±%u ‰ (min %u Cv)\n\n",
+           LOOP_SETTLE_BAND_PERMILLE, LOOP_SETTLE_BAND_MIN);
+    printf("  %-9s %5s %8s %10s %12s %12s\n", "source", "tick", "consigne",
+           "établ. ms", "dépass. Cv", "err. stat.");
+
+    for (uint16_t tickMs : rates) {
+        for (uint8_t s = 0U; s < PowerLoop::LOOP_COUNT; s++) {
+            const PowerAllocator::Source source = static_cast<PowerAllocator::Source>(s);
+            const uint16_t target = (s == 0U) ? 800U : 1500U;
+
+            PowerLoop loop(tickMs);
+            loop.setLimit(PowerAllocator::Source::ELECTRIC, BATTERY_MAX_POWER);
+            loop.setLimit(PowerAllocator::Source::THERMAL, UrgenceConfig::THERMAL_MAX);
+
+            const int32_t open = runStep(loop, source, target, tickMs, false);
+
+            PowerLoop closedLoop(tickMs);
+            closedLoop.setLimit(PowerAllocator::Source::ELECTRIC, BATTERY_MAX_POWER);
+            closedLoop.setLimit(PowerAllocator::Source::THERMAL, UrgenceConfig::THERMAL_MAX);
+            const int32_t error = runStep(closedLoop, source, target, tickMs, true);
+            const PowerLoop::StepMetrics& metrics = closedLoop.getMetrics(source);
+
+            printf("  %-9s %3u ms %8u %10u %12u %5d (bo %d)\n",
+                   (s == 0U) ? "ELEC" : "THRM", tickMs, target, metrics.settling,
+                   metrics.overshoot, error, open);
+
+            if (!metrics.settled || (error > 1) || (error < -1)) {
+                failures++;
+            }
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Coût d'un tick (deux PID, capteurs compris)
+    // ------------------------------------------------------------------------
+    PowerLoop loop(CONTROL_TICK_INTERVAL);
+    loop.setSensor(PowerAllocator::Source::ELECTRIC, readPlant);
+    loop.setSensor(PowerAllocator::Source::THERMAL, readPlant);
+    plants[0] = { 0.95, 20.0, 400.0 };
+    plants[1] = { 0.92, 1500.0, 900.0 };
+
+    const uint32_t ticks = 20000000U;
+    volatile uint32_t sink = 0U;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < ticks; i++) {
+        const PowerDistribution::PowerOutput setpoint = {
+            static_cast<uint16_t>(i & 0x3FFU), static_cast<uint16_t>(i & 0x7FFU), 0U
+        };
+        loop.tick(setpoint);
+        sink = sink + loop.getCommand().total;
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / ticks;
+
+    printf("\nCoût PowerLoop::tick(): %.1f ns (hôte)\n", ns);
+    for (uint16_t tickMs : rates) {
+        printf("  %4u Hz → %.4f %% CPU hôte\n", 1000U / tickMs, ns * (1000.0 / tickMs) * 1e-7);
+    }
+
+    if (failures != 0) {
+        printf("\n%d régulation(s) non établie(s)\n", failures);
+        return 1;
+    }
+
+    printf("\nOK\n");
+    return 0;
+}
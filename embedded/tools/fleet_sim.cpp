@@ -0,0 +1,504 @@
+/**
+ * @file fleet_sim.cpp
+ * @brief Simulation de flotte sur une saison (multi-cœur, vol de tâches)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC de dimensionnement: N avions, état en tableaux séparés (SoA:
+ * mode, puissance totale, électrique, thermique, énergie batterie), avancés
+ * à pas de 1 s avec les profils PowerDistribution du firmware. Chaque jour
+ * est une époque: la flotte est découpée en blocs de FLEET_CHUNK avions
+ * répartis sur des files par thread ; un thread à court de travail vole
+ * des blocs aux autres. Tableaux alignés sur une ligne de cache et blocs
+ * multiples d'une ligne: deux threads ne partagent aucune ligne écrite.
+ * Les statistiques sont cumulées par thread (entiers, aucun atomique sur
+ * le chemin chaud) puis fusionnées en fin d'époque et diffusées jour par
+ * jour. Résultats identiques quel que soit le nombre de threads.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -pthread -I../PowerManagement fleet_sim.cpp \
+ *       ../PowerManagement/PowerDistribution.cpp ../PowerManagement/PowerAllocator.cpp \
+ *       ../PowerManagement/ModeLimits.cpp ../PowerManagement/Crc.cpp \
+ *       -o fleet_sim
+ *
+ * Usage: ./fleet_sim [avions] [jours] [threads]
+ *        ./fleet_sim --scaling [avions] [jours] [threads max]   (débit de 1 à 32 threads)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+#include "config.h"
+#include "PowerDistribution.h"
+#include "PowerUnits.h"
+
+namespace {
+
+    typedef PowerDistribution::FlightMode Mode;
+
+    /** @brief Avions par bloc (unité de vol de tâche, tient en L1) */
+    constexpr uint32_t FLEET_CHUNK = 64U;
+
+    /** @brief Ligne de cache (x86-64, Cortex-A / Apple M: 64 ou 128 octets) */
+    constexpr size_t CACHE_LINE = 64U;
+
+    // Tableaux alignés sur une ligne et bloc multiple d'une ligne pour le plus
+    // petit élément (uint8_t): deux blocs voisins, traités par deux threads,
+    // ne partagent aucune ligne (pas de faux partage, écrites chaque seconde)
+    static_assert((FLEET_CHUNK * sizeof(uint8_t)) % CACHE_LINE == 0U,
+                  "FLEET_CHUNK doit couvrir des lignes de cache entières");
+
+    /**
+     * @brief Allocateur aligné sur une ligne de cache (C++11, sans aligned new)
+     *
+     * Sur-alloue CACHE_LINE octets et range le pointeur d'origine juste avant
+     * le bloc aligné.
+     */
+    template<typename T>
+    struct LineAllocator {
+        typedef T value_type;
+
+        LineAllocator() {}
+        template<typename U>
+        LineAllocator(const LineAllocator<U>&) {}
+
+        T* allocate(size_t count) {
+            void* raw = malloc(count * sizeof(T) + CACHE_LINE + sizeof(void*));
+            if (raw == nullptr) {
+                throw std::bad_alloc();
+            }
+            const uintptr_t base = reinterpret_cast<uintptr_t>(raw) + sizeof(void*);
+            void** aligned = reinterpret_cast<void**>((base + CACHE_LINE - 1U) & ~(CACHE_LINE - 1U));
+            aligned[-1] = raw;
+            return reinterpret_cast<T*>(aligned);
+        }
+
+        void deallocate(T* pointer, size_t) {
+            free(reinterpret_cast<void**>(pointer)[-1]);
+        }
+    };
+
+    template<typename T, typename U>
+    bool operator==(const LineAllocator<T>&, const LineAllocator<U>&) { return true; }
+    template<typename T, typename U>
+    bool operator!=(const LineAllocator<T>&, const LineAllocator<U>&) { return false; }
+
+    /** @brief Tableau de la flotte aligné sur une ligne de cache */
+    template<typename T>
+    using LineVector = std::vector<T, LineAllocator<T>>;
+
+    /** @brief Secondes par jour (époque) */
+    constexpr uint32_t DAY_SECONDS = 86400U;
+
+    /** @brief Énergie batterie utile (J) à tension nominale */
+    constexpr uint32_t BATTERY_ENERGY_J = static_cast<uint32_t>(
+        BATTERY_CAPACITY_MAH * 36ULL * ((BATTERY_VOLTAGE_FULL_MV + BATTERY_VOLTAGE_EMPTY_MV) / 2U) / 10000ULL);
+
+    /** @brief Réserve non utilisée pour le boost (J) */
+    constexpr uint32_t BATTERY_RESERVE_J = (BATTERY_ENERGY_J / 1000U) * BATTERY_RESERVE_PERMILLE;
+
+    /** @brief Puissance de recharge au sol (W) */
+    constexpr uint32_t CHARGER_W = 50000U;
+
+    /** @brief Phase au sol (après les phases de vol) */
+    constexpr uint8_t PHASE_GROUND = 5U;
+
+    /**
+     * @brief Gabarit d'une phase de vol (tirage uniforme dans les bornes)
+     */
+    struct PhaseTemplate {
+        Mode mode;           ///< Mode de vol
+        uint16_t powerMin;   ///< Puissance minimale (Cv)
+        uint16_t powerMax;   ///< Puissance maximale (Cv)
+        uint16_t timeMin;    ///< Durée minimale (s)
+        uint16_t timeMax;    ///< Durée maximale (s)
+    };
+
+    const PhaseTemplate PHASES[PHASE_GROUND] = {
+        { Mode::DECOLLAGE, 3000U, 3250U, 60U,   60U },    // Décollage
+        { Mode::DECOLLAGE, 2400U, 2900U, 600U,  1200U },  // Montée
+        { Mode::NORMAL,    1600U, 2400U, 1800U, 9000U },  // Croisière
+        { Mode::NORMAL,    600U,  1000U, 600U,  1200U },  // Descente
+        { Mode::NORMAL,    1000U, 1600U, 300U,  300U }    // Approche
+    };
+
+    /**
+     * @brief État de la flotte, un tableau par grandeur (SoA)
+     *
+     * Chaque tableau commence sur une ligne de cache ; les blocs de
+     * FLEET_CHUNK avions tombent donc sur des frontières de ligne.
+     */
+    struct Fleet {
+        LineVector<uint8_t> mode;          ///< Mode de vol
+        LineVector<uint16_t> total;        ///< Puissance demandée (Cv)
+        LineVector<uint16_t> electric;     ///< Puissance électrique (Cv)
+        LineVector<uint16_t> thermal;      ///< Puissance thermique (Cv)
+        LineVector<uint32_t> energy;       ///< Énergie batterie (J) → SoC
+        LineVector<uint8_t> phase;         ///< Phase courante (PHASE_GROUND au sol)
+        LineVector<uint16_t> remaining;    ///< Secondes restantes dans la phase
+        LineVector<uint8_t> flightsLeft;   ///< Vols restants dans la journée
+        LineVector<uint32_t> rng;          ///< Générateur xorshift32 par avion
+
+        explicit Fleet(uint32_t count)
+            : mode(count, 0U), total(count, 0U), electric(count, 0U), thermal(count, 0U)
+            , energy(count, BATTERY_ENERGY_J), phase(count, PHASE_GROUND), remaining(count, 0U)
+            , flightsLeft(count, 0U), rng(count, 0U)
+        {
+            for (uint32_t i = 0U; i < count; i++) {
+                rng[i] = 0x9E3779B9UL ^ (i * 0x85EBCA6BUL) ^ 1U;
+            }
+        }
+
+        uint32_t size() const { return static_cast<uint32_t>(mode.size()); }
+    };
+
+    /**
+     * @brief Statistiques cumulées (entiers: fusion exacte et ordre-indépendante)
+     */
+    struct alignas(CACHE_LINE) FleetStats {
+        uint64_t electricJ;      ///< Énergie électrique délivrée (J)
+        uint64_t thermalJ;       ///< Énergie thermique délivrée (J)
+        uint64_t airborne;       ///< Secondes de vol
+        uint64_t saturated;      ///< Secondes où la demande n'est pas couverte
+        uint64_t batteryLimited; ///< Secondes où la batterie a bridé l'électrique
+        uint32_t flights;        ///< Vols commencés
+        uint32_t minEnergy;      ///< Énergie batterie minimale atteinte (J)
+
+        void clear() {
+            electricJ = thermalJ = airborne = saturated = batteryLimited = 0U;
+            flights = 0U;
+            minEnergy = BATTERY_ENERGY_J;
+        }
+
+        void merge(const FleetStats& other) {
+            electricJ += other.electricJ;
+            thermalJ += other.thermalJ;
+            airborne += other.airborne;
+            saturated += other.saturated;
+            batteryLimited += other.batteryLimited;
+            flights += other.flights;
+            minEnergy = (other.minEnergy < minEnergy) ? other.minEnergy : minEnergy;
+        }
+    };
+
+    inline uint32_t nextRandom(uint32_t& state) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    inline uint16_t uniform(uint32_t& state, uint16_t low, uint16_t high) {
+        return static_cast<uint16_t>(low + (nextRandom(state) % (static_cast<uint32_t>(high - low) + 1U)));
+    }
+
+    /**
+     * @brief Démarre une phase de vol tirée de son gabarit
+     */
+    inline void enterPhase(Fleet& fleet, uint32_t i, uint8_t phase) {
+        const PhaseTemplate& phaseTemplate = PHASES[phase];
+        fleet.phase[i] = phase;
+        fleet.mode[i] = static_cast<uint8_t>(phaseTemplate.mode);
+        fleet.total[i] = uniform(fleet.rng[i], phaseTemplate.powerMin, phaseTemplate.powerMax);
+        fleet.remaining[i] = uniform(fleet.rng[i], phaseTemplate.timeMin, phaseTemplate.timeMax);
+
+        // Une approche sur 50 en URGENCE (remise des gaz)
+        if ((phase == 4U) && ((nextRandom(fleet.rng[i]) % 50U) == 0U)) {
+            fleet.mode[i] = static_cast<uint8_t>(Mode::URGENCE);
+            fleet.total[i] = UrgenceConfig::MAX_POWER;
+        }
+    }
+
+    /**
+     * @brief Simule un jour complet pour un bloc d'avions
+     *
+     * Temps en boucle externe, avions en boucle interne: chaque seconde
+     * balaie des tableaux contigus de FLEET_CHUNK éléments.
+     */
+    void simulateChunk(const PowerDistribution& distribution, Fleet& fleet,
+                       uint32_t begin, uint32_t end, FleetStats& stats) {
+        // Programme du jour: 1 à 4 vols, premier départ entre 5 h et 9 h
+        for (uint32_t i = begin; i < end; i++) {
+            fleet.flightsLeft[i] = static_cast<uint8_t>(uniform(fleet.rng[i], 1U, 4U));
+            fleet.phase[i] = PHASE_GROUND;
+            fleet.remaining[i] = uniform(fleet.rng[i], 18000U, 32400U);
+            fleet.total[i] = fleet.electric[i] = fleet.thermal[i] = 0U;
+        }
+
+        for (uint32_t t = 0U; t < DAY_SECONDS; t++) {
+            for (uint32_t i = begin; i < end; i++) {
+                if (fleet.phase[i] == PHASE_GROUND) {
+                    const uint32_t charged = fleet.energy[i] + CHARGER_W;
+                    fleet.energy[i] = (charged < BATTERY_ENERGY_J) ? charged : BATTERY_ENERGY_J;
+
+                    if ((--fleet.remaining[i] == 0U) && (fleet.flightsLeft[i] > 0U)) {
+                        fleet.flightsLeft[i]--;
+                        stats.flights++;
+                        enterPhase(fleet, i, 0U);
+                    }
+                    continue;
+                }
+
+                // Répartition du firmware, électrique bridé par la batterie
+                const Mode mode = static_cast<Mode>(fleet.mode[i]);
+                const PowerAllocator::Allocation allocation = distribution.allocate(mode, fleet.total[i]);
+                const uint16_t wanted = allocation.power[static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)];
+                const uint16_t limit = (fleet.energy[i] > BATTERY_RESERVE_J) ? BATTERY_MAX_POWER : 0U;
+                const uint16_t electric = (wanted < limit) ? wanted : limit;
+
+                const uint16_t thermalMax = distribution.getProfile(mode).getMax(PowerAllocator::Source::THERMAL);
+                const uint32_t spilled = allocation.power[static_cast<uint8_t>(PowerAllocator::Source::THERMAL)]
+                                       + static_cast<uint32_t>(wanted - electric);
+                const uint16_t thermal = static_cast<uint16_t>((spilled < thermalMax) ? spilled : thermalMax);
+
+                fleet.electric[i] = electric;
+                fleet.thermal[i] = thermal;
+
+                const uint32_t electricW = PowerUnits::cvToWatts(electric);
+                fleet.energy[i] = (fleet.energy[i] > electricW) ? (fleet.energy[i] - electricW) : 0U;
+
+                stats.electricJ += electricW;
+                stats.thermalJ += PowerUnits::cvToWatts(thermal);
+                stats.airborne++;
+                stats.saturated += ((static_cast<uint32_t>(electric) + thermal) < fleet.total[i]) ? 1U : 0U;
+                stats.batteryLimited += (electric < wanted) ? 1U : 0U;
+                stats.minEnergy = (fleet.energy[i] < stats.minEnergy) ? fleet.energy[i] : stats.minEnergy;
+
+                if (--fleet.remaining[i] == 0U) {
+                    const uint8_t next = static_cast<uint8_t>(fleet.phase[i] + 1U);
+                    if (next < PHASE_GROUND) {
+                        enterPhase(fleet, i, next);
+                    } else {
+                        // Escale: 30 à 90 min, ou fin de journée au sol
+                        fleet.phase[i] = PHASE_GROUND;
+                        fleet.total[i] = fleet.electric[i] = fleet.thermal[i] = 0U;
+                        fleet.remaining[i] = (fleet.flightsLeft[i] > 0U) ? uniform(fleet.rng[i], 1800U, 5400U) : 0xFFFFU;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Pool de threads à vol de tâches, une époque à la fois
+     *
+     * Chaque thread possède une file de blocs: il dépile par la fin, les
+     * voleurs prennent par le début. Le verrou d'une file n'est pris qu'une
+     * fois par bloc (des millions de pas), jamais dans la boucle de simulation.
+     */
+    class FleetPool {
+    public:
+        FleetPool(uint32_t threads, const PowerDistribution& distribution, Fleet& fleet)
+            : distribution_(distribution)
+            , fleet_(fleet)
+            , workers_(threads)
+            , generation_(0U)
+            , running_(0U)
+            , stop_(false)
+        {
+            const uint32_t chunks = (fleet.size() + FLEET_CHUNK - 1U) / FLEET_CHUNK;
+            for (Worker& worker : workers_) {
+                worker.queue.reserve(chunks);
+            }
+            for (uint32_t id = 0U; id < threads; id++) {
+                threads_.emplace_back(&FleetPool::run, this, id);
+            }
+        }
+
+        ~FleetPool() {
+            {
+                std::lock_guard<std::mutex> guard(epochLock_);
+                stop_ = true;
+            }
+            start_.notify_all();
+            for (std::thread& thread : threads_) {
+                thread.join();
+            }
+        }
+
+        /**
+         * @brief Simule un jour pour toute la flotte, fusionne les statistiques
+         */
+        FleetStats runEpoch() {
+            // Répartition initiale en tourniquet
+            const uint32_t chunks = (fleet_.size() + FLEET_CHUNK - 1U) / FLEET_CHUNK;
+            for (Worker& worker : workers_) {
+                worker.queue.clear();
+                worker.head = 0U;
+                worker.stats.clear();
+            }
+            for (uint32_t c = 0U; c < chunks; c++) {
+                workers_[c % workers_.size()].queue.push_back(c);
+            }
+
+            {
+                std::unique_lock<std::mutex> guard(epochLock_);
+                running_ = static_cast<uint32_t>(workers_.size());
+                generation_++;
+                start_.notify_all();
+                done_.wait(guard, [this]() { return running_ == 0U; });
+            }
+
+            FleetStats total;
+            total.clear();
+            for (const Worker& worker : workers_) {
+                total.merge(worker.stats);
+            }
+            return total;
+        }
+
+    private:
+        /**
+         * @brief File de blocs et statistiques d'un thread (ligne de cache dédiée)
+         */
+        struct alignas(CACHE_LINE) Worker {
+            std::mutex lock;               ///< Protège queue/head
+            std::vector<uint32_t> queue;   ///< Blocs à traiter
+            uint32_t head = 0U;            ///< Premier bloc non volé
+            FleetStats stats;              ///< Cumul local
+        };
+
+        const PowerDistribution& distribution_;
+        Fleet& fleet_;
+        std::vector<Worker> workers_;
+        std::vector<std::thread> threads_;
+        std::mutex epochLock_;
+        std::condition_variable start_;
+        std::condition_variable done_;
+        uint64_t generation_;
+        uint32_t running_;
+        bool stop_;
+
+        bool popLocal(Worker& worker, uint32_t& chunk) {
+            std::lock_guard<std::mutex> guard(worker.lock);
+            if (worker.queue.size() <= worker.head) {
+                return false;
+            }
+            chunk = worker.queue.back();
+            worker.queue.pop_back();
+            return true;
+        }
+
+        bool steal(uint32_t thief, uint32_t& chunk) {
+            const uint32_t count = static_cast<uint32_t>(workers_.size());
+            for (uint32_t k = 1U; k < count; k++) {
+                Worker& victim = workers_[(thief + k) % count];
+                std::lock_guard<std::mutex> guard(victim.lock);
+                if (victim.queue.size() > victim.head) {
+                    chunk = victim.queue[victim.head++];
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void run(uint32_t id) {
+            uint64_t seen = 0U;
+            Worker& self = workers_[id];
+
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> guard(epochLock_);
+                    start_.wait(guard, [this, seen]() { return stop_ || (generation_ != seen); });
+                    if (stop_) {
+                        return;
+                    }
+                    seen = generation_;
+                }
+
+                uint32_t chunk = 0U;
+                while (popLocal(self, chunk) || steal(id, chunk)) {
+                    const uint32_t begin = chunk * FLEET_CHUNK;
+                    const uint32_t end = (begin + FLEET_CHUNK < fleet_.size()) ? (begin + FLEET_CHUNK) : fleet_.size();
+                    simulateChunk(distribution_, fleet_, begin, end, self.stats);
+                }
+
+                std::lock_guard<std::mutex> guard(epochLock_);
+                if (--running_ == 0U) {
+                    done_.notify_one();
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Simule la saison, diffuse un bilan par jour
+     *
+     * @return Avion-secondes simulées par seconde
+     */
+    double runSeason(uint32_t aircraft, uint32_t days, uint32_t threads, bool verbose) {
+        const PowerDistribution distribution;
+        Fleet fleet(aircraft);
+        FleetPool pool(threads, distribution, fleet);
+        FleetStats season;
+        season.clear();
+
+        if (verbose) {
+            printf("%u avions, %u jours, %u threads\n\n", aircraft, days, threads);
+            printf("  %4s %6s %10s %10s %9s %9s %7s\n",
+                   "jour", "vols", "élec. MWh", "therm. MWh", "sat. %", "bridé %", "SoC min");
+        }
+
+        const auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t day = 1U; day <= days; day++) {
+            const FleetStats stats = pool.runEpoch();
+            season.merge(stats);
+
+            if (verbose) {
+                const double airborne = (stats.airborne > 0U) ? static_cast<double>(stats.airborne) : 1.0;
+                printf("  %4u %6u %10.2f %10.2f %9.3f %9.3f %6.1f%%\n", day, stats.flights,
+                       stats.electricJ / 3.6e9, stats.thermalJ / 3.6e9,
+                       100.0 * stats.saturated / airborne, 100.0 * stats.batteryLimited / airborne,
+                       100.0 * stats.minEnergy / BATTERY_ENERGY_J);
+                fflush(stdout);
+            }
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+
+        const double wall = std::chrono::duration<double>(t1 - t0).count();
+        const double steps = static_cast<double>(aircraft) * DAY_SECONDS * days;
+
+        if (verbose) {
+            const double share = 100.0 * season.electricJ / static_cast<double>(season.electricJ + season.thermalJ);
+            printf("\nSaison: %u vols, %.1f MWh électriques (%.1f %%), %.1f MWh thermiques\n",
+                   season.flights, season.electricJ / 3.6e9, share, season.thermalJ / 3.6e9);
+            printf("%.3g avion-secondes en %.2f s (%.3g /s)\n", steps, wall, steps / wall);
+        }
+        return steps / wall;
+    }
+}
+
+int main(int argc, char** argv) {
+    const uint32_t cores = (std::thread::hardware_concurrency() > 0U) ? std::thread::hardware_concurrency() : 1U;
+
+    if ((argc > 1) && (strcmp(argv[1], "--scaling") == 0)) {
+        const uint32_t aircraft = (argc > 2) ? static_cast<uint32_t>(atoi(argv[2])) : 4096U;
+        const uint32_t days = (argc > 3) ? static_cast<uint32_t>(atoi(argv[3])) : 1U;
+        const uint32_t maxThreads = (argc > 4) ? static_cast<uint32_t>(atoi(argv[4])) : 32U;
+
+        printf("Passage à l'échelle: %u avions, %u jour(s), %u cœurs\n\n", aircraft, days, cores);
+        printf("  %7s %14s %10s\n", "threads", "avion-s / s", "accél.");
+        double reference = 0.0;
+        for (uint32_t threads = 1U; threads <= maxThreads; threads *= 2U) {
+            const double rate = runSeason(aircraft, days, threads, false);
+            reference = (threads == 1U) ? rate : reference;
+            printf("  %7u %14.3g %9.2f×\n", threads, rate, rate / reference);
+            fflush(stdout);
+        }
+        return 0;
+    }
+
+    const uint32_t aircraft = (argc > 1) ? static_cast<uint32_t>(atoi(argv[1])) : 1024U;
+    const uint32_t days = (argc > 2) ? static_cast<uint32_t>(atoi(argv[2])) : 7U;
+    const uint32_t threads = (argc > 3) ? static_cast<uint32_t>(atoi(argv[3])) : cores;
+
+    runSeason((aircraft > 0U) ? aircraft : 1U, (days > 0U) ? days : 1U, (threads > 0U) ? threads : 1U, true);
+    return 0;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file idle_check.cpp
+ * @brief Vérification de la veille entre échéances (HAL host)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC: rejoue l'ordonnancement de loop() (tick de contrôle à
+ * CONTROL_TICK_INTERVAL, veille Hal::sleep() jusqu'à l'échéance) pendant
+ * qu'un second thread joue le rôle des interruptions encodeur/boutons
+ * (Hal::wake() à intervalles pseudo-aléatoires). Mesure le temps CPU
+ * réellement consommé (charge), le retard des ticks sur leur échéance et
+ * la latence front → reprise ; vérifie qu'aucun front n'est perdu.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -pthread -I../PowerManagement idle_check.cpp \
+ *       ../PowerManagement/Hal.cpp -o idle_check
+ *
+ * Usage: ./idle_check [durée ms]   (défaut 2000)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "config.h"
+#include "Hal.h"
+
+namespace {
+
+    /** @brief Intervalle moyen entre deux fronts simulés (µs) */
+    constexpr uint32_t EDGE_INTERVAL_US = 7000UL;
+
+    /** @brief Charge maximale admise (‰): une boucle active donnerait ~1000 */
+    constexpr uint32_t MAX_DUTY_PERMIL = 100U;
+
+    std::atomic<bool> running(true);
+    std::atomic<uint32_t> edgesSent(0U);
+
+    /**
+     * @brief Fronts d'entrée: Hal::wake() depuis un autre thread
+     */
+    void edgeSource() {
+        uint32_t seed = 0x1234567UL;
+        while (running.load()) {
+            seed = seed * 1103515245UL + 12345UL;
+            const uint32_t gap = (EDGE_INTERVAL_US / 2U) + ((seed >> 8) % EDGE_INTERVAL_US);
+            std::this_thread::sleep_for(std::chrono::microseconds(gap));
+            Hal::wake();
+            edgesSent++;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const uint32_t durationMs = (argc > 1) ? static_cast<uint32_t>(atoi(argv[1])) : 2000U;
+    const uint32_t tickUs = CONTROL_TICK_INTERVAL * 1000UL;
+
+    uint32_t ticks = 0U;
+    uint32_t wakes = 0U;
+    uint32_t tickLateMax = 0U;
+    uint64_t tickLateSum = 0U;
+    uint32_t wakeLatencyMax = 0U;
+    uint64_t wakeLatencySum = 0U;
+    uint64_t idleUs = 0U;
+
+    std::thread edges(edgeSource);
+    const clock_t cpuStart = clock();
+    const uint32_t start = Hal::micros();
+    uint32_t deadline = start + tickUs;
+
+    while ((Hal::micros() - start) < durationMs * 1000UL) {
+        const uint32_t idleStart = Hal::micros();
+        uint32_t stamp = 0U;
+        bool woken = false;
+
+        for (;;) {
+            if (Hal::takeWake(&stamp)) {
+                woken = true;
+                break;
+            }
+            const int32_t remaining = static_cast<int32_t>(deadline - Hal::micros());
+            if (remaining <= 0) {
+                break;
+            }
+            Hal::sleep(static_cast<uint32_t>(remaining));
+        }
+
+        const uint32_t now = Hal::micros();
+        idleUs += now - idleStart;
+
+        if (woken) {
+            const uint32_t latency = now - stamp;
+            wakeLatencySum += latency;
+            wakeLatencyMax = (latency > wakeLatencyMax) ? latency : wakeLatencyMax;
+            wakes++;
+        }
+
+        // Tick dû: rattrapage sans dérive, comme loop()
+        while (static_cast<int32_t>(now - deadline) >= 0) {
+            const uint32_t late = now - deadline;
+            tickLateSum += late;
+            tickLateMax = (late > tickLateMax) ? late : tickLateMax;
+            deadline += tickUs;
+            ticks++;
+        }
+    }
+
+    const uint32_t wallUs = Hal::micros() - start;
+    const double cpuUs = (static_cast<double>(clock() - cpuStart) * 1e6) / CLOCKS_PER_SEC;
+    running = false;
+    edges.join();
+
+    // Dernier front éventuellement émis après la sortie de boucle
+    uint32_t stamp = 0U;
+    if (Hal::takeWake(&stamp)) {
+        wakes++;
+    }
+
+    const uint32_t duty = static_cast<uint32_t>((cpuUs * 1000.0) / wallUs);
+    const uint32_t expectedTicks = wallUs / tickUs;
+
+    printf("Veille entre échéances: tick %u ms, %u ms simulées\n\n", CONTROL_TICK_INTERVAL, wallUs / 1000U);
+    printf("  %-28s %10u / %u\n", "ticks exécutés", ticks, expectedTicks);
+    printf("  %-28s %10.2f / %u µs\n", "retard tick moyen / max",
+           (ticks > 0U) ? static_cast<double>(tickLateSum) / ticks : 0.0, tickLateMax);
+    printf("  %-28s %10u / %u\n", "fronts traités / émis", wakes, edgesSent.load());
+    printf("  %-28s %10.2f / %u µs\n", "latence réveil moy. / max",
+           (wakes > 0U) ? static_cast<double>(wakeLatencySum) / wakes : 0.0, wakeLatencyMax);
+    printf("  %-28s %10.1f %%\n", "temps en veille", (static_cast<double>(idleUs) * 100.0) / wallUs);
+    printf("  %-28s %10u ‰ (CPU %.0f µs)\n", "charge CPU", duty, cpuUs);
+
+    // Les fronts rapprochés se cumulent en un seul réveil: jamais plus de traités que d'émis
+    int failures = 0;
+    if ((ticks + 1U) < expectedTicks) {
+        printf("ECHEC ticks manqués\n");
+        failures++;
+    }
+    if ((wakes == 0U) || (wakes > edgesSent.load())) {
+        printf("ECHEC fronts non traités\n");
+        failures++;
+    }
+    if (duty > MAX_DUTY_PERMIL) {
+        printf("ECHEC attente active (charge %u ‰)\n", duty);
+        failures++;
+    }
+
+    if (failures != 0) {
+        printf("\n%d ECHEC(S)\n", failures);
+        return 1;
+    }
+
+    printf("\nOK\n");
+    return 0;
+}
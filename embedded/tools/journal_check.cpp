@@ -0,0 +1,243 @@
+/**
+ * @file journal_check.cpp
+ * @brief Vérification du journal d'état persistant sur fichier projeté
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC: exécute StateJournal contre la HAL host (Hal::attachStorage,
+ * fichier mmap) et simule des redémarrages (détache / rattache le fichier,
+ * nouvelle instance). Vérifie la restauration du dernier état, le repli
+ * sur l'enregistrement précédent après une écriture interrompue (CRC),
+ * la rotation des emplacements (usure), la calibration (257 points en
+ * pages flash émulées, alternance des deux emplacements, repli après
+ * corruption) et les statistiques ; refus d'une EEPROM trop petite ;
+ * mesure le coût de begin(). EEPROM de 1 Ko comme le F103.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -I../PowerManagement journal_check.cpp \
+ *       ../PowerManagement/StateJournal.cpp ../PowerManagement/Crc.cpp \
+ *       ../PowerManagement/Hal.cpp ../PowerManagement/Calibration.cpp \
+ *       ../PowerManagement/UsageStats.cpp -o journal_check
+ *
+ * Usage: ./journal_check [écritures] [fichier]   (défaut 100000, journal_check.bin)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "config.h"
+#include "Hal.h"
+#include "StateJournal.h"
+
+namespace {
+
+    /** @brief EEPROM émulée du STM32F103 (une page) */
+    constexpr uint32_t STORAGE_SIZE = 1024UL;
+
+    /** @brief Redémarrage simulé toutes les N écritures */
+    constexpr uint32_t REBOOT_EVERY = 97U;
+
+    const char* storagePath = "journal_check.bin";
+    int failures = 0;
+
+    void expect(bool condition, const char* what) {
+        if (!condition && (failures++ < 10)) {
+            printf("ECHEC %s\n", what);
+        }
+    }
+
+    /**
+     * @brief Redémarrage: fichier rattaché, journal rouvert
+     */
+    void reboot(StateJournal& journal) {
+        Hal::detachStorage();
+        Hal::attachStorage(storagePath, STORAGE_SIZE);
+        journal = StateJournal();
+        journal.begin();
+    }
+
+    StateJournal::State makeState(uint32_t i) {
+        StateJournal::State state;
+        state.mode = static_cast<uint8_t>(i % PowerDistribution::MODE_COUNT);
+        state.flags = static_cast<uint8_t>((i / 3U) & StateJournal::FLAG_COMPENSATION);
+        state.power = static_cast<uint16_t>((i * 37U) % 3751U);
+        return state;
+    }
+}
+
+int main(int argc, char** argv) {
+    const uint32_t writes = (argc > 1) ? static_cast<uint32_t>(atoi(argv[1])) : 100000U;
+    if (argc > 2) {
+        storagePath = argv[2];
+    }
+
+    // Stockage vierge (flash effacée)
+    remove(storagePath);
+    if (!Hal::attachStorage(storagePath, STORAGE_SIZE)) {
+        printf("ECHEC projection de %s\n", storagePath);
+        return 1;
+    }
+
+    StateJournal journal;
+    expect(journal.begin(), "ouverture du stockage");
+    StateJournal::State restored;
+    expect(!journal.restoreState(&restored), "stockage vierge sans état");
+
+    expect(journal.isCalibrationPersistent(), "pages de calibration disponibles");
+    printf("Journal: EEPROM %u octets sur %u, %u emplacements d'état ; pages %u x %u octets\n\n",
+           StateJournal::requiredSize(), STORAGE_SIZE, JOURNAL_STATE_SLOTS,
+           JOURNAL_FLASH_PAGES, Hal::pageSize());
+
+    // ------------------------------------------------------------------------
+    // Écritures successives, redémarrages intercalés
+    // ------------------------------------------------------------------------
+    uint32_t reboots = 0U;
+    double beginUs = 0.0;
+    for (uint32_t i = 1U; i <= writes; i++) {
+        const StateJournal::State state = makeState(i);
+        if (journal.saveState(state)) {
+            journal.commit();
+        }
+
+        if ((i % REBOOT_EVERY) == 0U) {
+            const auto t0 = std::chrono::steady_clock::now();
+            reboot(journal);
+            beginUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+            reboots++;
+
+            expect(journal.restoreState(&restored) && (restored == state), "restauration du dernier état");
+        }
+    }
+    const uint32_t sequence = journal.getStateSequence();
+
+    // Rotation: chaque emplacement porte une des JOURNAL_STATE_SLOTS dernières séquences
+    const uint32_t slotSize = 8U + sizeof(StateJournal::State) + 4U;  // en-tête, état, CRC
+    uint32_t oldest = 0xFFFFFFFFUL;
+    uint32_t newest = 0UL;
+    for (uint8_t slot = 0U; slot < JOURNAL_STATE_SLOTS; slot++) {
+        uint32_t slotSequence = 0UL;
+        Hal::nvRead((slot * slotSize) + 4U, &slotSequence, sizeof(slotSequence));
+        oldest = (slotSequence < oldest) ? slotSequence : oldest;
+        newest = (slotSequence > newest) ? slotSequence : newest;
+    }
+    expect((newest == sequence) && (newest - oldest == JOURNAL_STATE_SLOTS - 1U), "rotation des emplacements");
+
+    printf("  %-28s %10u\n", "états écrits", sequence);
+    printf("  %-28s %10u\n", "redémarrages vérifiés", reboots);
+    printf("  %-28s %5u..%-4u\n", "écritures par emplacement",
+           sequence / JOURNAL_STATE_SLOTS, (sequence + JOURNAL_STATE_SLOTS - 1U) / JOURNAL_STATE_SLOTS);
+    printf("  %-28s %10.2f µs\n", "begin() + projection", (reboots > 0U) ? beginUs / reboots : 0.0);
+
+    // ------------------------------------------------------------------------
+    // Écriture interrompue: dernier enregistrement corrompu → précédent
+    // ------------------------------------------------------------------------
+    const StateJournal::State before = makeState(writes + 1U);
+    const StateJournal::State torn = makeState(writes + 2U);
+    journal.saveState(before);
+    journal.saveState(torn);
+    journal.commit();
+
+    const uint32_t tornOffset = ((journal.getStateSequence() - 1U) % JOURNAL_STATE_SLOTS) * slotSize + 8U;
+    uint8_t byte = 0U;
+    Hal::nvRead(tornOffset, &byte, 1U);
+    byte ^= 0x5AU;
+    Hal::nvWrite(tornOffset, &byte, 1U);
+
+    reboot(journal);
+    expect(journal.restoreState(&restored) && (restored == before), "repli sur l'enregistrement précédent");
+    printf("  %-28s %10s\n", "écriture interrompue", (restored == before) ? "repli" : "ECHEC");
+
+    // ------------------------------------------------------------------------
+    // Calibration: 257 points, deux emplacements par courbe
+    // ------------------------------------------------------------------------
+    CalibrationCurve saved(CalibrationCurve::Source::THERMAL);
+    uint32_t restoredCurves = 0U;
+    for (uint32_t round = 0U; round < 6U; round++) {
+        // Pages réécrites: sans effacement, la programmation émulée (ET) corromprait
+        saved.beginLoad(0U, CALIBRATION_MAX_POINTS);
+        for (uint16_t i = 0U; i < CALIBRATION_MAX_POINTS; i++) {
+            saved.appendPoint((static_cast<uint32_t>(i) * (700U + round)) + round);
+        }
+        saved.commitLoad();
+        expect(journal.saveCalibration(saved), "calibration enregistrée");
+        reboot(journal);
+
+        CalibrationCurve loaded(CalibrationCurve::Source::THERMAL);
+        const bool same = journal.restoreCalibration(loaded)
+            && (loaded.getCount() == CALIBRATION_MAX_POINTS)
+            && (loaded.toWatts(200U) == saved.toWatts(200U));
+        expect(same, "calibration restaurée");
+        restoredCurves += same ? 1U : 0U;
+    }
+    printf("  %-28s %10u / 6 (%u points)\n", "calibrations restaurées", restoredCurves, CALIBRATION_MAX_POINTS);
+
+    // Dernier enregistrement corrompu: la courbe précédente reste disponible
+    const uint32_t previousWatts = saved.toWatts(200U);
+    CalibrationCurve newer(CalibrationCurve::Source::THERMAL);
+    newer.beginLoad(4U, 3U);
+    newer.appendPoint(0U);
+    newer.appendPoint(50000U);
+    newer.appendPoint(90000U);
+    newer.commitLoad();
+    journal.saveCalibration(newer);
+
+    // Zone thermique après les deux emplacements électriques ; séquence 7 → emplacement 0
+    const uint32_t stride = ((8U + 4U + (CALIBRATION_MAX_POINTS * 4U) + 4U + Hal::pageSize() - 1U)
+                             / Hal::pageSize()) * Hal::pageSize();
+    const uint8_t cleared = 0U;
+    Hal::pageWrite((2U * stride) + 8U + 4U + 4U, &cleared, 1U);
+    reboot(journal);
+
+    CalibrationCurve fallback(CalibrationCurve::Source::THERMAL);
+    expect(journal.restoreCalibration(fallback) && (fallback.getCount() == CALIBRATION_MAX_POINTS)
+           && (fallback.toWatts(200U) == previousWatts), "repli sur la courbe précédente");
+    printf("  %-28s %10s\n", "calibration corrompue",
+           (fallback.toWatts(200U) == previousWatts) ? "repli" : "ECHEC");
+
+    CalibrationCurve electric(CalibrationCurve::Source::ELECTRIC);
+    expect(!journal.restoreCalibration(electric) && electric.isDefault(), "courbe électrique jamais chargée");
+
+    // ------------------------------------------------------------------------
+    // Statistiques (sans histogramme)
+    // ------------------------------------------------------------------------
+    static UsageStats usage;
+    usage.begin(false);
+    PowerDistribution::PowerOutput command = { 500U, 1500U, 2000U };
+    for (uint32_t t = 0U; t < 1000U; t++) {
+        usage.record(PowerDistribution::FlightMode::NORMAL, command, false);
+    }
+
+    journal.saveUsage(usage);
+    journal.commit();
+    reboot(journal);
+
+    static UsageStats reloaded;
+    reloaded.begin(false);
+    const UsageStats::Mode& normal = reloaded.getMode(PowerDistribution::FlightMode::NORMAL);
+    expect(journal.restoreUsage(reloaded) && (normal.ticks == 1000U)
+           && (normal.engine[1].sum == usage.getMode(PowerDistribution::FlightMode::NORMAL).engine[1].sum)
+           && (normal.engine[1].max == 1500U), "statistiques restaurées");
+    printf("  %-28s %10u ticks\n", "statistiques restaurées", normal.ticks);
+
+    // ------------------------------------------------------------------------
+    // EEPROM trop petite: journal refusé au démarrage
+    // ------------------------------------------------------------------------
+    Hal::detachStorage();
+    remove(storagePath);
+    Hal::attachStorage(storagePath, StateJournal::requiredSize() - 1U);
+    StateJournal small;
+    expect(!small.begin() && !small.isAvailable(), "EEPROM trop petite refusée");
+    printf("  %-28s %10s\n", "EEPROM de 1 octet trop petite", small.isAvailable() ? "ECHEC" : "refusée");
+
+    Hal::detachStorage();
+    remove(storagePath);
+
+    if (failures != 0) {
+        printf("\n%d ECHEC(S)\n", failures);
+        return 1;
+    }
+
+    printf("\nOK\n");
+    return 0;
+}
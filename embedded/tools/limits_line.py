@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""
+Générateur de la ligne de commande 'k' (limites par mode, ModeLimits).
+
+Relit les valeurs par défaut dans PowerManagement/config.h (namespaces
+DecollageConfig / NormalConfig / UrgenceConfig), applique les
+modifications demandées et imprime la ligne à envoyer sur le port série:
+
+    k <27 valeurs> <crc>
+
+9 champs par mode, modes dans l'ordre DECOLLAGE, NORMAL, URGENCE ; CRC-32
+(zlib) des champs en uint16 petit-boutiste, comme ModeLimits::crcOf().
+Les bornes (min <= init <= max <= élec + therm, pentes non nulles...) sont
+revérifiées par le firmware avant l'échange.
+
+Usage:
+    python3 limits_line.py                                  # valeurs par défaut
+    python3 limits_line.py URGENCE.THERMAL_MAX=2600 NORMAL.MAX_POWER=2600
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+MODES = (("DECOLLAGE", "DecollageConfig"),
+         ("NORMAL", "NormalConfig"),
+         ("URGENCE", "UrgenceConfig"))
+FIELDS = ("MIN_POWER", "MAX_POWER", "INITIAL_POWER", "ELECTRIC_MAX", "THERMAL_MAX",
+          "ELECTRIC_RAMP_UP", "ELECTRIC_RAMP_DOWN", "THERMAL_RAMP_UP", "THERMAL_RAMP_DOWN")
+DEFAULT_CONFIG = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              "..", "PowerManagement", "config.h")
+
+CONSTANT_RE = re.compile(r"constexpr\s+uint16_t\s+(\w+)\s*=\s*(\d+)U?\s*;")
+
+
+def load_defaults(path):
+    """Retourne {mode: [9 valeurs]} ; champ absent (NORMAL sans électrique) = 0."""
+    with open(path, encoding="utf-8") as f:
+        source = f.read()
+    table = {}
+    for mode, namespace in MODES:
+        start = source.index("namespace %s {" % namespace)
+        body = source[start:source.index("}", start)]
+        values = dict((name, int(value)) for name, value in CONSTANT_RE.findall(body))
+        table[mode] = [values.get(field, 0) for field in FIELDS]
+    return table
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("changes", nargs="*", help="MODE.CHAMP=valeur")
+    parser.add_argument("--config", default=DEFAULT_CONFIG, help="chemin de config.h")
+    args = parser.parse_args()
+
+    table = load_defaults(args.config)
+    for change in args.changes:
+        match = re.match(r"^(\w+)\.(\w+)=(\d+)$", change)
+        if not match or match.group(1) not in table or match.group(2) not in FIELDS:
+            sys.exit("modification invalide: %s" % change)
+        value = int(match.group(3))
+        if value > 0xFFFF:
+            sys.exit("valeur hors uint16: %s" % change)
+        table[match.group(1)][FIELDS.index(match.group(2))] = value
+
+    values = [value for mode, _ in MODES for value in table[mode]]
+    crc = zlib.crc32(struct.pack("<%dH" % len(values), *values)) & 0xFFFFFFFF
+    print("k " + " ".join(str(value) for value in values) + " %d" % crc)
+
+
+if __name__ == "__main__":
+    main()
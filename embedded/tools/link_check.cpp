@@ -0,0 +1,148 @@
+/**
+ * @file link_check.cpp
+ * @brief Vérification de la négociation de vitesse et du débit émulé (host)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC, deux parties:
+ * 1. Protocole LinkRate: proposition, ping CRC valide/corrompu, second
+ *    ping après le PONG (seul à confirmer), PONG perdu (aucun second ping:
+ *    repli au délai réarmé), délai dépassé, vitesse non supportée,
+ *    proposition pendant une confirmation.
+ * 2. Débit: la HAL host cadence l'UART émulé à la vitesse déclarée
+ *    (Hal::serialRate) ; un émetteur remplit la place libre en continu
+ *    pendant une fenêtre, le débit mesuré doit suivre la vitesse.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -I../PowerManagement link_check.cpp \
+ *       ../PowerManagement/LinkRate.cpp ../PowerManagement/Crc.cpp \
+ *       ../PowerManagement/Hal.cpp -o link_check
+ *
+ * Usage: ./link_check [fenêtre ms]   (défaut 300)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <thread>
+#include "config.h"
+#include "Hal.h"
+#include "LinkRate.h"
+
+namespace {
+
+    int failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            printf("ECHEC %s\n", what);
+            failures++;
+        }
+    }
+
+    /**
+     * @brief Débit soutenu de l'UART émulé (octets/s)
+     */
+    double measureThroughput(uint32_t baudrate, uint32_t windowMs) {
+        Hal::serialRate(baudrate);
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto end = start + std::chrono::milliseconds(windowMs);
+        uint64_t bytes = 0U;
+
+        while (std::chrono::steady_clock::now() < end) {
+            const uint16_t room = Hal::serialRoom(64U);
+            Hal::serialSent(room);
+            bytes += room;
+            // Pas de sleep: à 2 Mbps le tampon se vide en 320 µs, un réveil
+            // tardif laisserait l'UART inactif et fausserait la mesure
+            if (room == 0U) {
+                std::this_thread::yield();
+            }
+        }
+
+        // Le tampon de 64 octets rempli au départ n'est pas du débit
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return static_cast<double>(bytes - 64U) / seconds;
+    }
+}
+
+int main(int argc, char** argv) {
+    const uint32_t windowMs = (argc > 1) ? static_cast<uint32_t>(atoi(argv[1])) : 300U;
+
+    // ------------------------------------------------------------------------
+    // 1. Protocole
+    // ------------------------------------------------------------------------
+    printf("Négociation\n");
+    {
+        LinkRate rate;
+        const uint32_t nonce = 0x5EEDU;
+
+        check(rate.getBaudrate() == SERIAL_BAUDRATE, "vitesse initiale");
+        check(!rate.propose(57600UL, 0U), "vitesse non supportée refusée");
+        check(rate.propose(921600UL, 100U), "921600 acceptée");
+        check(!rate.propose(460800UL, 100U), "proposition refusée pendant la confirmation");
+        check(!rate.confirm(nonce, LinkRate::pingCrc(nonce, SERIAL_BAUDRATE), 100U), "ping à l'ancienne vitesse refusé");
+        check(!rate.isExpired(100U + LINK_CONFIRM_TIMEOUT_MS - 1U), "délai non écoulé");
+        check(rate.confirm(nonce, LinkRate::pingCrc(nonce, 921600UL), 900U), "ping valide");
+        check(rate.getState() == LinkRate::State::VERIFYING && rate.getConfirmed() == SERIAL_BAUDRATE,
+              "PONG émis, vitesse pas encore retenue");
+        check(!rate.isExpired(900U + LINK_CONFIRM_TIMEOUT_MS - 1U), "délai réarmé au PONG");
+        check(!rate.confirm(nonce + 1U, LinkRate::pingCrc(nonce + 1U, 921600UL) ^ 0x01U, 1000U)
+              && rate.getState() == LinkRate::State::VERIFYING, "second ping corrompu: attente maintenue");
+        check(rate.confirm(nonce + 1U, LinkRate::pingCrc(nonce + 1U, 921600UL), 1100U), "second ping valide");
+        check(rate.getState() == LinkRate::State::STABLE && rate.getConfirmed() == 921600UL, "921600 confirmée");
+        check(LinkRate::pongCrc(nonce, 921600UL) != LinkRate::pingCrc(nonce, 921600UL), "réponse distincte du ping");
+        printf("  ping + second ping: %u bps confirmés\n", static_cast<unsigned>(rate.getConfirmed()));
+
+        check(rate.propose(2000000UL, 5000U), "2M acceptée");
+        check(!rate.confirm(nonce, LinkRate::pingCrc(nonce, 2000000UL) ^ 0x10U, 5010U), "ping corrompu refusé");
+        check(rate.fallBack() == 921600UL, "repli sur la dernière confirmée");
+        printf("  ping corrompu: repli à %u bps\n", static_cast<unsigned>(rate.getBaudrate()));
+
+        // PONG corrompu: le PC revient seul à l'ancienne vitesse, aucun second ping
+        check(rate.propose(2000000UL, 6000U), "2M reproposée");
+        check(rate.confirm(nonce, LinkRate::pingCrc(nonce, 2000000UL), 6100U), "ping valide, PONG perdu");
+        check(!rate.isExpired(6100U + LINK_CONFIRM_TIMEOUT_MS - 1U), "attente du second ping");
+        check(rate.isExpired(6100U + LINK_CONFIRM_TIMEOUT_MS), "délai dépassé sans second ping");
+        check(rate.fallBack() == 921600UL && rate.getConfirmed() == 921600UL, "repli, 2M jamais retenue");
+        printf("  PONG perdu: repli à %u bps\n", static_cast<unsigned>(rate.getBaudrate()));
+
+        const uint32_t nearWrap = 0xFFFFFF00UL;
+        check(rate.propose(460800UL, nearWrap), "460800 acceptée (horloge proche du rebouclage)");
+        check(!rate.isExpired(static_cast<uint32_t>(nearWrap + LINK_CONFIRM_TIMEOUT_MS - 1U)), "délai à cheval sur le rebouclage");
+        check(rate.isExpired(static_cast<uint32_t>(nearWrap + LINK_CONFIRM_TIMEOUT_MS)), "délai dépassé");
+        check(rate.fallBack() == 921600UL, "repli après délai");
+        printf("  délai dépassé: repli à %u bps\n", static_cast<unsigned>(rate.getBaudrate()));
+
+        check(rate.getSwitches() == 1U && rate.getFallbacks() == 3U, "compteurs");
+        check(rate.confirm(nonce, LinkRate::pingCrc(nonce, 921600UL), 7000U), "ping hors négociation (contrôle de liaison)");
+        check(rate.getSwitches() == 1U && !rate.isNegotiating(), "ping hors négociation sans effet");
+    }
+
+    // ------------------------------------------------------------------------
+    // 2. Débit de l'UART émulé
+    // ------------------------------------------------------------------------
+    const uint32_t rates[] = { SERIAL_BAUDRATE, 460800UL, 921600UL, 2000000UL };
+    double base = 0.0;
+
+    printf("\nDébit émulé (fenêtre %u ms)\n", windowMs);
+    printf("  %10s %14s %14s %8s\n", "bps", "attendu o/s", "mesuré o/s", "gain");
+    for (uint32_t baudrate : rates) {
+        const double expected = baudrate / 10.0;
+        const double measured = measureThroughput(baudrate, windowMs);
+        base = (base == 0.0) ? measured : base;
+
+        printf("  %10u %14.0f %14.0f %7.1fx\n", static_cast<unsigned>(baudrate), expected, measured, measured / base);
+        check(measured > expected * 0.9 && measured < expected * 1.05, "débit émulé ≠ vitesse déclarée");
+    }
+
+    if (failures != 0) {
+        printf("\n%d ECHEC(S)\n", failures);
+        return 1;
+    }
+
+    printf("\nOK\n");
+    return 0;
+}
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""
+Négociation de la vitesse série côté PC (commande 'b', LinkRate.h).
+
+Séquence, une vitesse après l'autre jusqu'à la première confirmée:
+    1. "b <vitesse>" à la vitesse courante, attente de "[LINK] ACK"
+    2. bascule du port, "b <nonce> <crc>" ; crc = CRC-32 (zlib) de
+       {nonce, vitesse} en deux uint32 petit-boutistes
+    3. la réponse "[LINK] PONG ... CRC <x>" doit porter le CRC-32 de
+       {~nonce, vitesse} ; sinon (ou sans réponse) retour à la vitesse
+       précédente, le firmware y revient seul après LINK_CONFIRM_TIMEOUT_MS
+    4. PONG valide: second ping (nouveau nonce) à la nouvelle vitesse, le
+       firmware ne la retient qu'à ce ping et répond "[LINK] OK <vitesse>" ;
+       sans réponse après CONFIRM_ATTEMPTS essais, retour à la vitesse
+       précédente (le firmware, sans second ping valide, y revient aussi)
+
+Avec --bench, la décharge de la trace ('t') est chronométrée avant et
+après la négociation (même mesure sur le host: l'UART émulé suit la vitesse
+négociée, voir tools/link_check.cpp).
+
+Usage (nécessite pyserial):
+    python3 link_negotiate.py /dev/ttyUSB0
+    python3 link_negotiate.py /dev/ttyUSB0 --rates 921600 460800 --bench
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import time
+import zlib
+
+DEFAULT_RATES = (2000000, 921600, 460800)
+PONG_RE = re.compile(rb"\[LINK\] PONG (\d+) bps \| nonce (\d+) \| CRC ([0-9A-Fa-f]+)")
+OK_RE = re.compile(rb"\[LINK\] OK (\d+) bps")
+CONFIRM_ATTEMPTS = 2
+
+
+def crc_of_pair(a, b):
+    """CRC-32 de {a, b} comme LinkRate (uint32 petit-boutistes)."""
+    return zlib.crc32(struct.pack("<II", a & 0xFFFFFFFF, b)) & 0xFFFFFFFF
+
+
+def wait_for(port, pattern, timeout):
+    """Lit jusqu'à trouver pattern ; retourne la correspondance ou None."""
+    data = b""
+    end = time.monotonic() + timeout
+    while time.monotonic() < end:
+        data += port.read(256)
+        match = re.search(pattern, data)
+        if match:
+            return match
+    return None
+
+
+def ping(port, rate):
+    """Envoie un ping à la vitesse courante ; retourne le nonce."""
+    nonce = int.from_bytes(os.urandom(4), "little")
+    port.write(b"b %d %d\n" % (nonce, crc_of_pair(nonce, rate)))
+    return nonce
+
+
+def valid_pong(match, nonce, rate):
+    """PONG qui répond à nonce pour rate."""
+    return bool(match) and int(match.group(2)) == nonce \
+        and int(match.group(3), 16) == crc_of_pair(~nonce, rate)
+
+
+def negotiate(port, rate, timeout):
+    """Propose rate ; True si la vitesse est confirmée des deux côtés."""
+    previous = port.baudrate
+    port.reset_input_buffer()
+    port.write(b"b %d\n" % rate)
+    if not wait_for(port, rb"\[LINK\] ACK", timeout):
+        print("[LINK] %d bps refusée" % rate)
+        return False
+
+    port.flush()
+    time.sleep(0.02)  # laisse le firmware vider sa file et basculer
+    port.baudrate = rate
+    port.reset_input_buffer()
+
+    nonce = ping(port, rate)
+    if valid_pong(wait_for(port, PONG_RE, timeout), nonce, rate):
+        # PONG reçu: second ping pour que le firmware retienne la vitesse.
+        # Un PONG valide en retour signifie qu'il l'a déjà retenue (OK perdu)
+        for _ in range(CONFIRM_ATTEMPTS):
+            nonce = ping(port, rate)
+            match = wait_for(port, rb"\[LINK\] (OK|PONG) [^\n]*\n", timeout)
+            reply = match.group(0) if match else b""
+            ok = OK_RE.search(reply)
+            if (ok and int(ok.group(1)) == rate) or valid_pong(PONG_RE.search(reply), nonce, rate):
+                print("[LINK] %d bps confirmée" % rate)
+                return True
+
+    print("[LINK] %d bps: pas de réponse valide, retour à %d bps" % (rate, previous))
+    port.baudrate = previous
+    wait_for(port, rb"\[LINK\] ", timeout * 2)  # repli du firmware
+    return False
+
+
+def bench(port, timeout):
+    """Durée (s) et taille (octets) de la décharge de trace ('t')."""
+    port.reset_input_buffer()
+    start = time.monotonic()
+    port.write(b"t")
+    data = b""
+    while b"[TRACE] END" not in data and time.monotonic() - start < timeout:
+        data += port.read(4096)
+    return time.monotonic() - start, len(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port", help="port série")
+    parser.add_argument("--baud", type=int, default=115200, help="vitesse courante")
+    parser.add_argument("--rates", type=int, nargs="+", default=DEFAULT_RATES,
+                        help="vitesses à essayer, par ordre de préférence")
+    parser.add_argument("--timeout", type=float, default=0.5, help="attente d'une réponse (s)")
+    parser.add_argument("--bench", action="store_true", help="chronométrer 't' avant/après")
+    opts = parser.parse_args()
+
+    import serial  # pyserial
+    port = serial.Serial(opts.port, opts.baud, timeout=0.05)
+
+    before = bench(port, 10.0) if opts.bench else None
+    confirmed = any(negotiate(port, rate, opts.timeout) for rate in opts.rates)
+    if before:
+        after = bench(port, 10.0)
+        print("[LINK] trace: %d o en %.3f s -> %d o en %.3f s (x%.1f)"
+              % (before[1], before[0], after[1], after[0], before[0] / max(after[0], 1e-6)))
+
+    print("[LINK] vitesse finale %d bps" % port.baudrate)
+    sys.exit(0 if confirmed else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""
+Décodeur des trames de journalisation différée (LOG_DEFERRED = 1).
+
+Relit le catalogue PowerManagement/LogCatalog.h (source unique des chaînes
+de format) et reconstruit le texte des trames binaires émises par
+ARINCSimulator::sendLog. Les octets hors trame (dashboard, ARINC texte,
+aide...) sont recopiés tels quels.
+
+Trame: SYNC(0x1E) | id | longueur | varint(SEQ) varint(args)... | checksum
+       checksum = somme modulo 256 de id, longueur et charge utile
+
+Usage:
+    python3 log_decoder.py /dev/ttyUSB0 [--baud 115200]   # nécessite pyserial
+    python3 log_decoder.py capture.bin
+    cat capture.bin | python3 log_decoder.py -
+"""
+
+import argparse
+import codecs
+import os
+import re
+import sys
+
+FRAME_SYNC = 0x1E
+MODE_NAMES = ("DECOLLAGE", "NORMAL", "URGENCE")
+DEFAULT_CATALOG = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               "..", "PowerManagement", "LogCatalog.h")
+
+ENTRY_RE = re.compile(r'X\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+ESCAPES = {"n": "\n", "r": "\r", "t": "\t", "\\": "\\", '"': '"'}
+
+
+def unescape(text):
+    """Interprète les séquences d'échappement C d'un littéral."""
+    return re.sub(r"\\(.)", lambda m: ESCAPES.get(m.group(1), m.group(1)), text)
+
+
+def load_catalog(path):
+    """Retourne la liste (nom, format) indexée par identifiant."""
+    with open(path, encoding="utf-8") as f:
+        source = f.read()
+    body = source[source.index("#define LOG_CATALOG(X)"):]
+    body = body[:body.index("enum class LogId")]
+    return [(name, unescape(fmt)) for name, fmt in ENTRY_RE.findall(body)]
+
+
+def format_message(fmt, args):
+    """Applique les conversions du catalogue (%u %x %c %M %%)."""
+    out = []
+    it = iter(args)
+    i = 0
+    while i < len(fmt):
+        ch = fmt[i]
+        if ch != "%" or i + 1 >= len(fmt):
+            out.append(ch)
+            i += 1
+            continue
+        conv = fmt[i + 1]
+        i += 2
+        if conv == "%":
+            out.append("%")
+            continue
+        value = next(it, 0)
+        if conv == "u":
+            out.append(str(value))
+        elif conv == "x":
+            out.append("%X" % value)
+        elif conv == "c":
+            out.append(chr(value))
+        elif conv == "M":
+            out.append(MODE_NAMES[value] if value < len(MODE_NAMES) else "UNKNOWN")
+        else:
+            out.append("?")
+    return "".join(out)
+
+
+def decode_varints(payload):
+    """Décode une suite de varints (7 bits par octet, LSB d'abord)."""
+    values, value, shift = [], 0, 0
+    for byte in payload:
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            values.append(value)
+            value, shift = 0, 0
+    return values
+
+
+class Decoder:
+    """Machine à états octet par octet (flux mixte texte/trames)."""
+
+    def __init__(self, catalog, out):
+        self.catalog = catalog
+        self.out = out
+        self.pending = bytearray()
+        self.text = bytearray()
+        # Un seul décodeur: un caractère multi-octet coupé entre deux
+        # lectures est complété à la lecture suivante
+        self.utf8 = codecs.getincrementaldecoder("utf-8")(errors="replace")
+
+    def flush_text(self, final=False):
+        """Décode le texte reçu ; final=True en fin de flux ou avant une trame."""
+        if self.text or final:
+            self.out.write(self.utf8.decode(bytes(self.text), final))
+            self.text.clear()
+
+    def feed(self, data):
+        for byte in data:
+            if self.pending:
+                self.pending.append(byte)
+                if len(self.pending) >= 3 and len(self.pending) == 4 + self.pending[2]:
+                    self.emit_frame(bytes(self.pending))
+                    self.pending.clear()
+            elif byte == FRAME_SYNC:
+                self.flush_text(final=True)
+                self.pending.append(byte)
+            else:
+                self.text.append(byte)
+        self.flush_text()
+        self.out.flush()
+
+    def finish(self):
+        """Fin de flux: séquence UTF-8 incomplète remplacée."""
+        self.flush_text(final=True)
+        self.out.flush()
+
+    def emit_frame(self, frame):
+        msg_id, length = frame[1], frame[2]
+        payload, checksum = frame[3:3 + length], frame[3 + length]
+        if (sum(frame[1:3 + length]) & 0xFF) != checksum:
+            self.out.write("[DECODER] trame corrompue (checksum)\n")
+            return
+        values = decode_varints(payload)
+        if not values:
+            self.out.write("[DECODER] trame vide\n")
+            return
+        # values[0] = SEQ (compteur partagé avec les trames ARINC texte)
+        args = values[1:]
+        if msg_id >= len(self.catalog):
+            self.out.write("[DECODER] id inconnu %d (catalogue désynchronisé ?)\n" % msg_id)
+            return
+        self.out.write(format_message(self.catalog[msg_id][1], args) + "\n")
+
+
+def open_source(name, baud):
+    if name == "-":
+        return sys.stdin.buffer
+    if os.path.isfile(name):
+        return open(name, "rb")
+    import serial  # pyserial, uniquement pour un port série
+    return serial.Serial(name, baud, timeout=0.1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="port série, fichier de capture ou '-' (stdin)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--catalog", default=DEFAULT_CATALOG)
+    opts = parser.parse_args()
+
+    decoder = Decoder(load_catalog(opts.catalog), sys.stdout)
+    source = open_source(opts.source, opts.baud)
+    try:
+        while True:
+            data = source.read(256) if hasattr(source, "in_waiting") else source.read1(256)
+            if not data:
+                if hasattr(source, "in_waiting"):
+                    continue
+                break
+            decoder.feed(data)
+    except KeyboardInterrupt:
+        pass
+    decoder.finish()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,420 @@
+/**
+ * @file mission_optimizer.cpp
+ * @brief Optimisation hors ligne de la répartition électrique/thermique d'une mission
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC: pour un profil de mission (durée, mode, puissance totale), la
+ * capacité batterie de config.h et une courbe de consommation turbine,
+ * calcule par programmation dynamique sur l'état de charge discrétisé la
+ * part électrique à chaque pas qui minimise le carburant, SoC ≥ réserve.
+ *
+ * - Passe arrière: V[t][s] = min_e carburant(t, e) + V[t+1][s - énergie(e)].
+ *   Seules deux lignes de V sont gardées (16 Ko chacune, en cache) ; la
+ *   table de décisions (1 octet par état) est écrite une fois en flux.
+ * - Chaque thread traite une tranche fixe de SoC, par tuiles de
+ *   OPT_TILE états: décision en boucle externe, états en boucle interne
+ *   (accès contigus, vectorisables). Barrière entre deux pas de temps.
+ * - Décisions bornées par la demande et le plafond électrique du profil
+ *   (0 en NORMAL): le firmware écrêterait tout dépassement sans le dire.
+ * - Passe avant: suit la politique depuis la batterie pleine, compare à
+ *   la règle firmware « électrique d'abord », puis fusionne les pas
+ *   identiques en un programme compact { durée s, mode, total, électrique }
+ *   lisible par le firmware.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -pthread -I../PowerManagement mission_optimizer.cpp \
+ *       ../PowerManagement/PowerDistribution.cpp ../PowerManagement/PowerAllocator.cpp \
+ *       ../PowerManagement/ModeLimits.cpp ../PowerManagement/Crc.cpp \
+ *       -o mission_optimizer
+ *
+ * Usage: ./mission_optimizer [mission.csv|-] [programme.inc] [threads]
+ *        mission.csv: lignes "durée_s,mode,total_cv" (mode 0/1/2), '#' = commentaire
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "config.h"
+#include "PowerDistribution.h"
+#include "PowerUnits.h"
+
+namespace {
+
+    typedef PowerDistribution::FlightMode Mode;
+
+    /** @brief Pas de temps de la programmation dynamique (s) */
+    constexpr uint32_t OPT_STEP_S = 10U;
+
+    /** @brief Nombre d'états de charge discrets */
+    constexpr uint32_t OPT_SOC_STATES = 4096U;
+
+    /** @brief Pas de la décision électrique (Cv) */
+    constexpr uint16_t OPT_DECISION_CV = 25U;
+
+    /** @brief Nombre de décisions (0 à BATTERY_MAX_POWER) */
+    constexpr uint32_t OPT_DECISIONS = BATTERY_MAX_POWER / OPT_DECISION_CV + 1U;
+
+    /** @brief États par tuile (valeurs et meilleurs coûts en L1) */
+    constexpr uint32_t OPT_TILE = 512U;
+
+    /** @brief Pénalité par Cv·s de demande non servie (g) */
+    constexpr float UNMET_PENALTY_G = 1.0F;
+
+    /** @brief Valeur d'un état inaccessible */
+    constexpr float INFEASIBLE = 1.0e30F;
+
+    static_assert(OPT_DECISIONS <= 255U, "Décision codée sur un octet");
+
+    /** @brief Énergie batterie (J) à tension nominale */
+    constexpr double BATTERY_ENERGY_J =
+        BATTERY_CAPACITY_MAH * 3.6 * ((BATTERY_VOLTAGE_FULL_MV + BATTERY_VOLTAGE_EMPTY_MV) / 2.0) / 1000.0;
+
+    /** @brief Énergie d'un état de charge discret (J) */
+    constexpr double CELL_J = BATTERY_ENERGY_J / (OPT_SOC_STATES - 1U);
+
+    /** @brief Premier état autorisé (réserve) */
+    constexpr uint32_t RESERVE_STATE = static_cast<uint32_t>(
+        (OPT_SOC_STATES - 1U) * BATTERY_RESERVE_PERMILLE / 1000U);
+
+    /**
+     * @brief Segment de mission
+     */
+    struct Segment {
+        uint32_t duration;   ///< Durée (s)
+        Mode mode;           ///< Mode de vol
+        uint16_t total;      ///< Puissance totale demandée (Cv)
+    };
+
+    /** @brief Mission par défaut (profil de plant_sim) */
+    const Segment DEFAULT_MISSION[] = {
+        { 60U,   Mode::DECOLLAGE, 3250U },
+        { 900U,  Mode::DECOLLAGE, 2800U },
+        { 3600U, Mode::NORMAL,    2000U },
+        { 900U,  Mode::NORMAL,    800U },
+        { 300U,  Mode::URGENCE,   1500U }
+    };
+
+    /**
+     * @brief Débit carburant turbine (g/s) pour une puissance thermique
+     *
+     * Consommation spécifique dégradée à charge partielle: ralenti +
+     * terme linéaire + terme quadratique (PW127: ~20 g/s au ralenti,
+     * ~160 g/s à 2750 Cv).
+     */
+    float fuelFlow(uint16_t thermal) {
+        const float power = static_cast<float>(thermal);
+        return 20.0F + 0.04F * power + 4.4e-6F * power * power;
+    }
+
+    /**
+     * @brief Énergie prélevée sur la batterie pendant un pas (J, pertes RI² incluses)
+     */
+    double drawnEnergy(uint16_t electric, uint32_t seconds) {
+        const double watts = static_cast<double>(PowerUnits::cvToWatts(electric));
+        const double volts = (BATTERY_VOLTAGE_FULL_MV + BATTERY_VOLTAGE_EMPTY_MV) / 2000.0;
+        const double current = watts / volts;
+        return (watts + current * current * (BATTERY_RESISTANCE_MOHM / 1000.0)) * seconds;
+    }
+
+    /**
+     * @brief Pas de temps de la mission discrétisée
+     */
+    struct Step {
+        Mode mode;            ///< Mode de vol
+        uint16_t total;       ///< Puissance demandée (Cv)
+        uint16_t electricMax; ///< Plafond électrique du mode (Cv, 0 en NORMAL)
+        uint16_t thermalMax;  ///< Plafond thermique du mode (Cv)
+        uint32_t seconds;     ///< Durée du pas (s)
+    };
+
+    /**
+     * @brief Coût et énergie d'une décision pour un pas
+     */
+    struct Decision {
+        float fuel;       ///< Carburant (g), pénalité incluse
+        uint32_t shift;   ///< États de charge consommés
+        bool valid;       ///< Électrique ≤ demande et ≤ plafond électrique du mode
+    };
+
+    Decision evaluate(const Step& step, uint32_t index) {
+        Decision decision;
+        const uint16_t electric = static_cast<uint16_t>(index * OPT_DECISION_CV);
+        // Au-delà du plafond du mode, le firmware écrête la consigne (applyOverride)
+        const uint16_t ceiling = (step.total < step.electricMax) ? step.total : step.electricMax;
+        decision.valid = (electric <= ceiling) || (index == 0U);
+
+        const uint16_t wanted = static_cast<uint16_t>(step.total - ((electric < step.total) ? electric : step.total));
+        const uint16_t thermal = (wanted < step.thermalMax) ? wanted : step.thermalMax;
+        decision.fuel = (fuelFlow(thermal) + UNMET_PENALTY_G * (wanted - thermal)) * step.seconds;
+        decision.shift = static_cast<uint32_t>(drawnEnergy(electric, step.seconds) / CELL_J + 0.5);
+        return decision;
+    }
+
+    /**
+     * @brief Barrière réutilisable (un pas de temps = une génération)
+     */
+    class Barrier {
+    public:
+        explicit Barrier(uint32_t count) : count_(count), waiting_(0U), generation_(0U) {}
+
+        void wait() {
+            std::unique_lock<std::mutex> guard(lock_);
+            const uint64_t generation = generation_;
+            if (++waiting_ == count_) {
+                waiting_ = 0U;
+                generation_++;
+                released_.notify_all();
+            } else {
+                released_.wait(guard, [this, generation]() { return generation_ != generation; });
+            }
+        }
+
+    private:
+        std::mutex lock_;
+        std::condition_variable released_;
+        uint32_t count_;
+        uint32_t waiting_;
+        uint64_t generation_;
+    };
+
+    /**
+     * @brief Tables de la programmation dynamique
+     */
+    struct Tables {
+        std::vector<float> value[2];     ///< V[t+1] et V[t] (alternées)
+        std::vector<uint8_t> policy;     ///< Décision par (pas, état)
+    };
+
+    /**
+     * @brief Passe arrière d'une tranche d'états [begin, end) pour tous les pas
+     */
+    void solveRange(const std::vector<Step>& steps, Tables& tables, Barrier& barrier,
+                    uint32_t begin, uint32_t end) {
+        float best[OPT_TILE];
+        uint8_t choice[OPT_TILE];
+        Decision decisions[OPT_DECISIONS];
+
+        for (uint32_t k = static_cast<uint32_t>(steps.size()); k-- > 0U;) {
+            const std::vector<float>& next = tables.value[(k + 1U) & 1U];
+            std::vector<float>& current = tables.value[k & 1U];
+            uint8_t* policy = &tables.policy[static_cast<size_t>(k) * OPT_SOC_STATES];
+
+            for (uint32_t d = 0U; d < OPT_DECISIONS; d++) {
+                decisions[d] = evaluate(steps[k], d);
+            }
+
+            for (uint32_t tile = begin; tile < end; tile += OPT_TILE) {
+                const uint32_t tileEnd = (tile + OPT_TILE < end) ? (tile + OPT_TILE) : end;
+
+                for (uint32_t s = tile; s < tileEnd; s++) {
+                    best[s - tile] = INFEASIBLE;
+                    choice[s - tile] = 0U;
+                }
+
+                for (uint32_t d = 0U; d < OPT_DECISIONS; d++) {
+                    if (!decisions[d].valid) {
+                        continue;
+                    }
+                    const uint32_t shift = decisions[d].shift;
+                    const float fuel = decisions[d].fuel;
+                    // Pas en-dessous de la réserve après le pas
+                    const uint32_t first = (RESERVE_STATE + shift > tile) ? (RESERVE_STATE + shift) : tile;
+
+                    for (uint32_t s = first; s < tileEnd; s++) {
+                        const float candidate = fuel + next[s - shift];
+                        const bool better = candidate < best[s - tile];
+                        best[s - tile] = better ? candidate : best[s - tile];
+                        choice[s - tile] = better ? static_cast<uint8_t>(d) : choice[s - tile];
+                    }
+                }
+
+                for (uint32_t s = tile; s < tileEnd; s++) {
+                    current[s] = best[s - tile];
+                    policy[s] = choice[s - tile];
+                }
+            }
+
+            barrier.wait();
+        }
+    }
+
+    /**
+     * @brief Lit un profil "durée_s,mode,total_cv" par ligne
+     */
+    bool loadMission(const char* path, std::vector<Segment>& mission) {
+        FILE* file = fopen(path, "r");
+        if (file == nullptr) {
+            return false;
+        }
+
+        char line[128];
+        while (fgets(line, sizeof(line), file) != nullptr) {
+            unsigned duration = 0U;
+            unsigned mode = 0U;
+            unsigned total = 0U;
+            if ((line[0] == '#') || (sscanf(line, "%u,%u,%u", &duration, &mode, &total) != 3)) {
+                continue;
+            }
+            if ((mode >= PowerDistribution::MODE_COUNT) || (total > 0xFFFFU) || (duration == 0U)) {
+                fprintf(stderr, "Ligne ignorée: %s", line);
+                continue;
+            }
+            mission.push_back({ duration, static_cast<Mode>(mode), static_cast<uint16_t>(total) });
+        }
+
+        fclose(file);
+        return !mission.empty();
+    }
+
+    /**
+     * @brief Écrit le programme compact: { durée s, mode, total Cv, électrique Cv }
+     */
+    uint32_t exportSchedule(FILE* out, const std::vector<Step>& steps, const std::vector<uint16_t>& electric) {
+        uint32_t rows = 0U;
+        size_t k = 0U;
+
+        fprintf(out, "// Généré par tools/mission_optimizer.cpp — { durée s, mode, total Cv, électrique Cv }\n");
+        while (k < steps.size()) {
+            uint32_t duration = 0U;
+            size_t j = k;
+            while ((j < steps.size()) && (steps[j].mode == steps[k].mode) && (steps[j].total == steps[k].total)
+                   && (electric[j] == electric[k]) && (duration + steps[j].seconds <= 0xFFFFU)) {
+                duration += steps[j].seconds;
+                j++;
+            }
+            fprintf(out, "{ %5uU, %uU, %4uU, %4uU },\n", duration, static_cast<unsigned>(steps[k].mode),
+                    steps[k].total, electric[k]);
+            rows++;
+            k = j;
+        }
+        return rows;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<Segment> mission;
+    if ((argc > 1) && (strcmp(argv[1], "-") != 0)) {
+        if (!loadMission(argv[1], mission)) {
+            fprintf(stderr, "Mission illisible: %s\n", argv[1]);
+            return 1;
+        }
+    } else {
+        mission.assign(DEFAULT_MISSION, DEFAULT_MISSION + sizeof(DEFAULT_MISSION) / sizeof(DEFAULT_MISSION[0]));
+    }
+    const char* outputPath = (argc > 2) ? argv[2] : nullptr;
+    const uint32_t cores = (std::thread::hardware_concurrency() > 0U) ? std::thread::hardware_concurrency() : 1U;
+    uint32_t threads = (argc > 3) ? static_cast<uint32_t>(atoi(argv[3])) : cores;
+    threads = (threads > 0U) ? threads : 1U;
+
+    // Discrétisation de la mission
+    const PowerDistribution distribution;
+    std::vector<Step> steps;
+    for (const Segment& segment : mission) {
+        for (uint32_t t = 0U; t < segment.duration; t += OPT_STEP_S) {
+            Step step;
+            step.mode = segment.mode;
+            step.total = segment.total;
+            step.electricMax = distribution.getProfile(segment.mode).getMax(PowerAllocator::Source::ELECTRIC);
+            step.thermalMax = distribution.getProfile(segment.mode).getMax(PowerAllocator::Source::THERMAL);
+            step.seconds = (segment.duration - t < OPT_STEP_S) ? (segment.duration - t) : OPT_STEP_S;
+            steps.push_back(step);
+        }
+    }
+
+    // Passe arrière parallèle
+    Tables tables;
+    tables.value[0].assign(OPT_SOC_STATES, INFEASIBLE);
+    tables.value[1].assign(OPT_SOC_STATES, INFEASIBLE);
+    tables.policy.assign(steps.size() * OPT_SOC_STATES, 0U);
+    std::vector<float>& terminal = tables.value[steps.size() & 1U];
+    for (uint32_t s = RESERVE_STATE; s < OPT_SOC_STATES; s++) {
+        terminal[s] = 0.0F;
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    {
+        Barrier barrier(threads);
+        std::vector<std::thread> workers;
+        // Tranches multiples de OPT_TILE
+        const uint32_t tiles = (OPT_SOC_STATES + OPT_TILE - 1U) / OPT_TILE;
+        for (uint32_t id = 0U; id < threads; id++) {
+            const uint32_t begin = (tiles * id / threads) * OPT_TILE;
+            const uint32_t endTile = (tiles * (id + 1U) / threads) * OPT_TILE;
+            const uint32_t end = (endTile < OPT_SOC_STATES) ? endTile : OPT_SOC_STATES;
+            workers.emplace_back(solveRange, std::cref(steps), std::ref(tables), std::ref(barrier), begin, end);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    // Passe avant: politique optimale contre « électrique d'abord »
+    std::vector<uint16_t> electric(steps.size(), 0U);
+    uint32_t state = OPT_SOC_STATES - 1U;
+    uint32_t overCap = 0U;
+    double optimalFuel = 0.0;
+    double baselineFuel = 0.0;
+    double baselineEnergy = BATTERY_ENERGY_J;
+    const double reserveEnergy = BATTERY_ENERGY_J * BATTERY_RESERVE_PERMILLE / 1000.0;
+
+    for (size_t k = 0U; k < steps.size(); k++) {
+        const uint8_t d = tables.policy[k * OPT_SOC_STATES + state];
+        const Decision decision = evaluate(steps[k], d);
+        electric[k] = static_cast<uint16_t>(d * OPT_DECISION_CV);
+        overCap += (electric[k] > steps[k].electricMax) ? 1U : 0U;
+        optimalFuel += decision.fuel;
+        state -= decision.shift;
+
+        const PowerAllocator::Allocation allocation = distribution.allocate(steps[k].mode, steps[k].total);
+        uint16_t firmware = allocation.power[static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)];
+        firmware = (baselineEnergy - drawnEnergy(firmware, steps[k].seconds) >= reserveEnergy) ? firmware : 0U;
+        baselineEnergy -= drawnEnergy(firmware, steps[k].seconds);
+        const uint16_t spilled = static_cast<uint16_t>(steps[k].total - firmware);
+        const uint16_t thermal = (spilled < steps[k].thermalMax) ? spilled : steps[k].thermalMax;
+        baselineFuel += (fuelFlow(thermal) + UNMET_PENALTY_G * (spilled - thermal)) * steps[k].seconds;
+    }
+
+    printf("Mission: %u segments, %u pas de %u s, %u états de charge, %u décisions, %u threads\n",
+           static_cast<unsigned>(mission.size()), static_cast<unsigned>(steps.size()), OPT_STEP_S,
+           OPT_SOC_STATES, OPT_DECISIONS, threads);
+    printf("Résolution: %.1f ms (%.3g transitions/s)\n\n",
+           std::chrono::duration<double, std::milli>(t1 - t0).count(),
+           static_cast<double>(steps.size()) * OPT_SOC_STATES * OPT_DECISIONS
+               / std::chrono::duration<double>(t1 - t0).count());
+    printf("  %-22s %12s %10s\n", "politique", "carburant kg", "SoC final");
+    printf("  %-22s %12.1f %9.1f%%\n", "électrique d'abord", baselineFuel / 1000.0,
+           100.0 * baselineEnergy / BATTERY_ENERGY_J);
+    printf("  %-22s %12.1f %9.1f%%\n", "optimale (DP)", optimalFuel / 1000.0,
+           100.0 * state / (OPT_SOC_STATES - 1U));
+    printf("\nGain: %.2f %%\n", 100.0 * (baselineFuel - optimalFuel) / baselineFuel);
+
+    FILE* out = (outputPath != nullptr) ? fopen(outputPath, "w") : nullptr;
+    if (outputPath != nullptr) {
+        if (out == nullptr) {
+            fprintf(stderr, "Écriture impossible: %s\n", outputPath);
+            return 1;
+        }
+        const uint32_t rows = exportSchedule(out, steps, electric);
+        fclose(out);
+        printf("Programme: %u lignes → %s\n", rows, outputPath);
+    } else {
+        printf("\nProgramme:\n");
+        exportSchedule(stdout, steps, electric);
+    }
+
+    // Programme exécutable tel quel: aucune consigne électrique au-delà du plafond du mode
+    if (overCap != 0U) {
+        printf("\n%u pas au-delà du plafond électrique du mode\n", overCap);
+    }
+    const bool ok = (optimalFuel <= baselineFuel + 1.0) && (state >= RESERVE_STATE) && (overCap == 0U);
+    printf("\n%s\n", ok ? "OK" : "ÉCHEC");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file plant_sim.cpp
+ * @brief Vol complet simulé plus vite que le temps réel (firmware + procédé)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC: exécute la chaîne de contrôle du firmware (PowerController,
+ * PowerLoop, BatteryModel) à CONTROL_TICK_INTERVAL, couplée au procédé
+ * PlantModel à 1 kHz via la HAL host (Hal::attachPlant) : les commandes
+ * sortent par Hal::writePower, les mesures rentrent par Hal::readPower,
+ * exactement comme sur cible. Affiche un bilan par phase et la vitesse
+ * de simulation.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -I../PowerManagement plant_sim.cpp PlantModel.cpp \
+ *       ../PowerManagement/Hal.cpp ../PowerManagement/PowerController.cpp \
+ *       ../PowerManagement/PowerDistribution.cpp ../PowerManagement/PowerAllocator.cpp \
+ *       ../PowerManagement/SetpointRamp.cpp ../PowerManagement/ModeBlend.cpp \
+ *       ../PowerManagement/TurbineSpool.cpp ../PowerManagement/BatteryModel.cpp \
+ *       ../PowerManagement/PowerLoop.cpp ../PowerManagement/PidController.cpp \
+ *       ../PowerManagement/ModeLimits.cpp ../PowerManagement/Crc.cpp \
+ *       -o plant_sim
+ *
+ * Usage: ./plant_sim [répétitions]   (répétitions pour stabiliser la mesure)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include "config.h"
+#include "Hal.h"
+#include "PowerUnits.h"
+#include "PowerController.h"
+#include "PowerLoop.h"
+#include "BatteryModel.h"
+#include "PlantModel.h"
+
+namespace {
+
+    typedef PowerDistribution::FlightMode Mode;
+
+    /**
+     * @brief Phase du profil de vol
+     */
+    struct Phase {
+        const char* label;   ///< Nom affiché
+        Mode mode;           ///< Mode de vol
+        uint16_t power;      ///< Puissance totale demandée (Cv)
+        uint32_t duration;   ///< Durée (s)
+    };
+
+    /** @brief Profil décollage / montée / croisière / descente / approche */
+    const Phase PROFILE[] = {
+        { "Décollage",  Mode::DECOLLAGE, 3250U, 60U },
+        { "Montée",     Mode::DECOLLAGE, 2800U, 900U },
+        { "Croisière",  Mode::NORMAL,    2000U, 3600U },
+        { "Descente",   Mode::NORMAL,    800U,  900U },
+        { "Approche",   Mode::URGENCE,   1500U, 300U }
+    };
+
+    /**
+     * @brief Procédé et son état, contexte des voies HAL
+     */
+    struct Simulation {
+        const PlantModel* model;   ///< Modèle (paramètres)
+        PlantModel::State state;   ///< État dynamique
+    };
+
+    void writePlant(void* context, uint8_t channel, uint16_t power) {
+        Simulation& sim = *static_cast<Simulation*>(context);
+        const float watts = static_cast<float>(PowerUnits::cvToWatts(power));
+
+        if (channel == static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)) {
+            sim.state.electricCmd = watts;
+        } else if (channel == static_cast<uint8_t>(PowerAllocator::Source::THERMAL)) {
+            sim.state.thermalCmd = watts;
+        }
+    }
+
+    bool readPlant(void* context, uint8_t channel, uint16_t* power) {
+        const Simulation& sim = *static_cast<const Simulation*>(context);
+        float watts = 0.0F;
+
+        if (channel == static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC)) {
+            watts = sim.model->electricPower(sim.state);
+        } else if (channel == static_cast<uint8_t>(PowerAllocator::Source::THERMAL)) {
+            watts = sim.model->thermalPower(sim.state);
+        } else {
+            return false;
+        }
+
+        *power = PowerUnits::wattsToCv(static_cast<uint32_t>((watts > 0.0F) ? watts : 0.0F));
+        return true;
+    }
+
+    bool readPowerSensor(PowerAllocator::Source source, uint16_t* power) {
+        return Hal::readPower(static_cast<uint8_t>(source), power);
+    }
+
+    /**
+     * @brief Bilan d'une phase
+     */
+    struct PhaseStats {
+        double electric;     ///< Somme des puissances électriques mesurées (Cv)
+        double thermal;      ///< Somme des puissances thermiques mesurées (Cv)
+        double squaredError; ///< Somme des écarts² demande/délivré (Cv²)
+        uint32_t samples;    ///< Nombre de ticks
+        uint16_t soc;        ///< SoC en fin de phase (‰)
+    };
+
+    /**
+     * @brief Exécute le profil complet
+     *
+     * @param stats Bilans par phase (sortie)
+     * @return Nombre de pas procédé simulés
+     */
+    uint64_t runProfile(const PlantModel& model, PhaseStats* stats) {
+        PowerDistribution distribution;
+        PowerController controller(distribution);
+        PowerLoop loop(CONTROL_TICK_INTERVAL);
+        BatteryModel battery(CONTROL_TICK_INTERVAL);
+
+        Simulation sim;
+        sim.model = &model;
+        model.reset(sim.state, 0.0F, 0.0F);
+
+        const Hal::Plant plant = { writePlant, readPlant, &sim };
+        Hal::attachPlant(&plant);
+
+        loop.setSensor(PowerAllocator::Source::ELECTRIC, readPowerSensor);
+        loop.setSensor(PowerAllocator::Source::THERMAL, readPowerSensor);
+        controller.reset(PROFILE[0].mode, 0U);
+
+        uint64_t steps = 0U;
+        for (uint8_t p = 0U; p < sizeof(PROFILE) / sizeof(PROFILE[0]); p++) {
+            const Phase& phase = PROFILE[p];
+            PhaseStats& phaseStats = stats[p];
+            phaseStats = PhaseStats();
+
+            const uint32_t ticks = (phase.duration * 1000U) / CONTROL_TICK_INTERVAL;
+            for (uint32_t t = 0U; t < ticks; t++) {
+                // Chaîne de controlTick() (PowerManagement.ino)
+                controller.tick(phase.mode, phase.power);
+                loop.setLimit(PowerAllocator::Source::THERMAL, controller.getMax(PowerAllocator::Source::THERMAL));
+                loop.tick(controller.getCommand());
+
+                const PowerDistribution::PowerOutput command = loop.getCommand();
+                Hal::writePower(static_cast<uint8_t>(PowerAllocator::Source::ELECTRIC), command.electric);
+                Hal::writePower(static_cast<uint8_t>(PowerAllocator::Source::THERMAL), command.thermal);
+
+                battery.tick(command.electric);
+                const uint16_t limit = battery.getPowerLimit();
+                distribution.setElectricLimit(limit);
+                controller.setElectricLimit(limit);
+                loop.setLimit(PowerAllocator::Source::ELECTRIC, limit);
+
+                model.advance(sim.state, CONTROL_TICK_INTERVAL);
+                steps += CONTROL_TICK_INTERVAL;
+
+                const double electric = loop.getMeasured(PowerAllocator::Source::ELECTRIC);
+                const double thermal = loop.getMeasured(PowerAllocator::Source::THERMAL);
+                const double error = static_cast<double>(distribution.calculate(phase.mode, phase.power).total)
+                                   - (electric + thermal);
+                phaseStats.electric += electric;
+                phaseStats.thermal += thermal;
+                phaseStats.squaredError += error * error;
+                phaseStats.samples++;
+            }
+
+            phaseStats.soc = battery.getSoc();
+        }
+
+        Hal::attachPlant(nullptr);
+        return steps;
+    }
+}
+
+int main(int argc, char** argv) {
+    const uint32_t repeat = (argc > 1) ? static_cast<uint32_t>(atoi(argv[1])) : 1U;
+    const PlantModel model(PlantModel::defaultParams());
+    const uint8_t phases = sizeof(PROFILE) / sizeof(PROFILE[0]);
+    PhaseStats stats[phases];
+
+    uint64_t steps = 0U;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t r = 0U; r < ((repeat > 0U) ? repeat : 1U); r++) {
+        steps += runProfile(model, stats);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    printf("Procédé 1 kHz, contrôle %u ms\n\n", CONTROL_TICK_INTERVAL);
+    printf("  %-11s %6s %7s %8s %8s %9s %6s\n",
+           "phase", "durée", "demande", "élec.", "therm.", "err. RMS", "SoC");
+    for (uint8_t p = 0U; p < phases; p++) {
+        const PhaseStats& s = stats[p];
+        printf("  %-11s %5us %7u %8.0f %8.0f %9.1f %5.1f%%\n",
+               PROFILE[p].label, PROFILE[p].duration, PROFILE[p].power,
+               s.electric / s.samples, s.thermal / s.samples,
+               sqrt(s.squaredError / s.samples), s.soc / 10.0);
+    }
+
+    const double wall = std::chrono::duration<double>(t1 - t0).count();
+    const double simulated = static_cast<double>(steps) * PlantModel::STEP;
+    printf("\n%.0f s simulées en %.1f ms (%.0f× temps réel, %.1f ns/pas procédé)\n",
+           simulated, wall * 1000.0, simulated / wall, wall * 1e9 / static_cast<double>(steps));
+    return 0;
+}
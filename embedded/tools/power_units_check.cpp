@@ -0,0 +1,149 @@
+/**
+ * @file power_units_check.cpp
+ * @brief Comparaison exhaustive PowerUnits (entier) / PowerDistribution (float)
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC: parcourt tout le domaine des conversions, vérifie que la version
+ * entière est exacte (référence rationnelle en 64 bits) et mesure l'écart de
+ * la version flottante, puis le coût par appel de chaque version.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -I../PowerManagement power_units_check.cpp \
+ *       ../PowerManagement/PowerDistribution.cpp ../PowerManagement/PowerAllocator.cpp \
+ *       ../PowerManagement/ModeLimits.cpp ../PowerManagement/Crc.cpp -o power_units_check
+ *
+ * Sur cible, le même coût se mesure avec le compteur DWT->CYCCNT (Cortex-M3)
+ * autour d'une boucle d'appels ; la version float y passe par __aeabi_fmul /
+ * __aeabi_fdiv, la version entière par une multiplication 32x32→64.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "PowerDistribution.h"
+#include "PowerUnits.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_TSC 1
+#else
+#define HAS_TSC 0
+#endif
+
+namespace {
+
+    volatile uint32_t sink = 0U;  ///< Empêche l'élimination des boucles de mesure
+
+    /**
+     * @brief Chronomètre une boucle d'appels
+     *
+     * @param label Nom affiché
+     * @param count Nombre d'appels
+     * @param body Appel à mesurer (argument: indice)
+     */
+    template<typename Body>
+    void measure(const char* label, uint32_t count, Body body) {
+#if HAS_TSC
+        const uint64_t c0 = __rdtsc();
+#endif
+        const auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t i = 0U; i < count; i++) {
+            body(i);
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / count;
+#if HAS_TSC
+        const double cycles = static_cast<double>(__rdtsc() - c0) / count;
+        printf("  %-28s %6.2f ns/appel  %6.1f cycles TSC/appel\n", label, ns, cycles);
+#else
+        printf("  %-28s %6.2f ns/appel\n", label, ns);
+#endif
+    }
+}
+
+int main() {
+    int failures = 0;
+
+    // ------------------------------------------------------------------------
+    // Cv → W (et % → W, même formule)
+    // ------------------------------------------------------------------------
+    uint32_t floatMismatch = 0U;
+    double floatMaxError = 0.0;
+
+    for (uint32_t cv = 0U; cv <= 0xFFFFU; cv++) {
+        // Référence rationnelle, arrondi demi vers le haut
+        const uint64_t exact = (static_cast<uint64_t>(cv) * PowerUnits::FACTOR_W + 50U) / 100U;
+        const uint32_t fixed = PowerUnits::cvToWatts(static_cast<uint16_t>(cv));
+        const float ref = PowerDistribution::cvToWatts(static_cast<uint16_t>(cv));
+
+        if (fixed != exact || PowerUnits::percentToWatts(static_cast<uint16_t>(cv)) != exact) {
+            if (failures++ < 10) {
+                printf("ECHEC cvToWatts(%u) = %u, attendu %llu\n",
+                       cv, fixed, static_cast<unsigned long long>(exact));
+            }
+        }
+
+        const double error = fabs(static_cast<double>(ref) - static_cast<double>(exact));
+        floatMaxError = (error > floatMaxError) ? error : floatMaxError;
+        if (static_cast<uint32_t>(lround(ref)) != exact) {
+            floatMismatch++;
+        }
+    }
+
+    printf("cvToWatts  : 65536 entrées, entier exact, float écart max %.6f W, %u arrondis différents\n",
+           floatMaxError, floatMismatch);
+
+    // ------------------------------------------------------------------------
+    // W → Cv (et W → %), jusqu'au-delà de la saturation
+    // ------------------------------------------------------------------------
+    const uint32_t wattsEnd = PowerUnits::SATURATION_W + 1000U;
+    floatMismatch = 0U;
+
+    for (uint32_t w = 0U; w <= wattsEnd; w++) {
+        const uint64_t q = (static_cast<uint64_t>(w) * 100U) / PowerUnits::FACTOR_W;
+        const uint16_t exact = (q > 0xFFFFU) ? 0xFFFFU : static_cast<uint16_t>(q);
+        const uint16_t fixed = PowerUnits::wattsToCv(w);
+        const uint16_t ref = PowerDistribution::wattsToCv(static_cast<float>(w));
+
+        if (fixed != exact || PowerUnits::wattsToPercent(w) != exact) {
+            if (failures++ < 10) {
+                printf("ECHEC wattsToCv(%u) = %u, attendu %u\n", w, fixed, exact);
+            }
+        }
+        if (w < PowerUnits::SATURATION_W && ref != exact) {
+            floatMismatch++;
+        }
+    }
+
+    printf("wattsToCv  : %u entrées, entier exact, float %u troncatures différentes\n",
+           wattsEnd + 1U, floatMismatch);
+    printf("turbine    : %u %% = %u W\n", TURBINE_CONSTANT_PERCENT, PowerUnits::TURBINE_CONSTANT_W);
+
+    // ------------------------------------------------------------------------
+    // Coût par appel (hôte ; voir en-tête pour la mesure sur cible)
+    // ------------------------------------------------------------------------
+    const uint32_t calls = 20000000U;
+    printf("\nCoût (hôte avec FPU, indicatif):\n");
+    measure("float cvToWatts", calls, [](uint32_t i) {
+        sink = sink + static_cast<uint32_t>(PowerDistribution::cvToWatts(static_cast<uint16_t>(i)));
+    });
+    measure("entier cvToWatts", calls, [](uint32_t i) {
+        sink = sink + PowerUnits::cvToWatts(static_cast<uint16_t>(i));
+    });
+    measure("float wattsToCv", calls, [](uint32_t i) {
+        sink = sink + PowerDistribution::wattsToCv(static_cast<float>(i & 0xFFFFFU));
+    });
+    measure("entier wattsToCv", calls, [](uint32_t i) {
+        sink = sink + PowerUnits::wattsToCv(i & 0xFFFFFU);
+    });
+
+    if (failures != 0) {
+        printf("\n%d ECHEC(S)\n", failures);
+        return 1;
+    }
+
+    printf("\nOK\n");
+    return 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file seqlock_check.cpp
+ * @brief Test de charge du Seqlock: détection de lectures déchirées
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC: un thread écrivain publie à pleine vitesse pendant que des
+ * threads lecteurs lisent en boucle et vérifient chaque valeur lue.
+ *
+ * Seqlock<Probe> (32 octets, 8 mots dérivés d'un même compteur): tout
+ * mélange de deux écritures est détecté ; témoin sans séquence (mêmes
+ * accès relâchés, mot par mot) pour montrer que le contrôle voit les
+ * déchirures quand l'ordonnanceur en produit.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -pthread -I../PowerManagement seqlock_check.cpp -o seqlock_check
+ *
+ * Usage: ./seqlock_check [durée par phase ms] [lecteurs]   (défaut 1000, 2)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "Seqlock.h"
+
+namespace {
+
+    /** @brief Valeur témoin: mot i = compteur × constante + i */
+    struct Probe {
+        uint32_t word[8];
+    };
+
+    constexpr uint32_t PROBE_STEP = 0x9E3779B1UL;
+
+    Probe makeProbe(uint32_t counter) {
+        Probe probe;
+        for (uint8_t i = 0U; i < 8U; i++) {
+            probe.word[i] = (counter * PROBE_STEP) + i;
+        }
+        return probe;
+    }
+
+    bool isCoherent(const Probe& probe) {
+        for (uint8_t i = 1U; i < 8U; i++) {
+            if (probe.word[i] != probe.word[0] + i) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** @brief Témoin sans séquence: mêmes accès mot par mot */
+    struct Unprotected {
+        uint32_t words[8];
+
+        void write(const Probe& probe) {
+            for (uint8_t i = 0U; i < 8U; i++) {
+                __atomic_store_n(&words[i], probe.word[i], __ATOMIC_RELAXED);
+            }
+        }
+
+        Probe read() const {
+            Probe probe;
+            for (uint8_t i = 0U; i < 8U; i++) {
+                probe.word[i] = __atomic_load_n(&words[i], __ATOMIC_RELAXED);
+            }
+            return probe;
+        }
+    };
+
+    /** @brief Compteurs d'un lecteur */
+    struct ReaderStats {
+        uint64_t reads;
+        uint64_t retries;
+        uint64_t torn;
+    };
+
+    struct PhaseResult {
+        uint64_t writes;
+        ReaderStats total;
+        double seconds;
+    };
+
+    /**
+     * @brief Lance un écrivain et N lecteurs pendant durationMs
+     */
+    template<typename Writer, typename Reader>
+    PhaseResult runPhase(uint32_t durationMs, uint8_t readers, Writer writer, Reader reader) {
+        std::atomic<bool> running(true);
+        std::atomic<uint64_t> writes(0U);
+        std::vector<ReaderStats> stats(readers, ReaderStats{ 0U, 0U, 0U });
+        std::vector<std::thread> threads;
+
+        const auto start = std::chrono::steady_clock::now();
+        threads.emplace_back([&] {
+            uint64_t count = 0U;
+            while (running.load(std::memory_order_relaxed)) {
+                writer(count++);
+            }
+            writes = count;
+        });
+        for (uint8_t r = 0U; r < readers; r++) {
+            threads.emplace_back([&, r] {
+                while (running.load(std::memory_order_relaxed)) {
+                    reader(stats[r]);
+                }
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+        running = false;
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        PhaseResult result = { writes.load(), { 0U, 0U, 0U },
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+        for (const ReaderStats& s : stats) {
+            result.total.reads += s.reads;
+            result.total.retries += s.retries;
+            result.total.torn += s.torn;
+        }
+        return result;
+    }
+
+    void printPhase(const char* name, const PhaseResult& result) {
+        printf("  %-24s %12llu %12llu %10llu %8llu\n", name,
+               static_cast<unsigned long long>(result.writes),
+               static_cast<unsigned long long>(result.total.reads),
+               static_cast<unsigned long long>(result.total.retries),
+               static_cast<unsigned long long>(result.total.torn));
+    }
+}
+
+int main(int argc, char** argv) {
+    const uint32_t durationMs = (argc > 1) ? static_cast<uint32_t>(atoi(argv[1])) : 1000U;
+    const uint8_t readers = (argc > 2) ? static_cast<uint8_t>(atoi(argv[2])) : 2U;
+
+    printf("Seqlock: 1 écrivain, %u lecteur(s), %u ms par phase, %u cœur(s)\n\n",
+           readers, durationMs, std::thread::hardware_concurrency());
+    printf("  %-24s %12s %12s %10s %8s\n", "phase", "écritures", "lectures", "reprises", "déchirées");
+
+    static Seqlock<Probe> probeLock;
+    const PhaseResult probe = runPhase(durationMs, readers,
+        [](uint64_t n) { probeLock.write(makeProbe(static_cast<uint32_t>(n))); },
+        [](ReaderStats& s) {
+            uint32_t retries = 0U;
+            const Probe value = probeLock.read(&retries);
+            s.reads++;
+            s.retries += retries;
+            s.torn += isCoherent(value) ? 0U : 1U;
+        });
+    printPhase("Seqlock<Probe>", probe);
+
+    static Unprotected bare = {};
+    bare.write(makeProbe(0U));
+    const PhaseResult control = runPhase(durationMs, readers,
+        [](uint64_t n) { bare.write(makeProbe(static_cast<uint32_t>(n))); },
+        [](ReaderStats& s) {
+            s.reads++;
+            s.torn += isCoherent(bare.read()) ? 0U : 1U;
+        });
+    printPhase("témoin sans séquence", control);
+
+    printf("\n  %-28s %10.1f M/s\n", "lectures Seqlock<Probe>", probe.total.reads / probe.seconds / 1e6);
+    printf("  %-28s %10.1f M/s\n", "écritures Seqlock<Probe>", probe.writes / probe.seconds / 1e6);
+
+    int failures = 0;
+    if (probe.total.torn != 0U) {
+        printf("ECHEC lecture déchirée à travers le Seqlock\n");
+        failures++;
+    }
+    if (probe.writes == 0U || probe.total.reads == 0U) {
+        printf("ECHEC aucune activité concurrente\n");
+        failures++;
+    }
+    if (control.total.torn == 0U) {
+        printf("(témoin: aucune déchirure observée sur cette machine)\n");
+    }
+
+    if (failures != 0) {
+        printf("\n%d ECHEC(S)\n", failures);
+        return 1;
+    }
+
+    printf("\nOK\n");
+    return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file spool_step_check.cpp
+ * @brief Réponse indicielle de la puissance délivrée, avec/sans compensation
+ * @author Hackathon FlyImpulse - Safran PW100
+ * @date 2026-02-07
+ *
+ * Outil PC: applique des échelons de consigne au PowerController (tick de
+ * CONTROL_TICK_INTERVAL) et compare le temps de montée à 90 % de la
+ * puissance totale délivrée (électrique + thermique modélisé) avec et sans
+ * compensation du retard turbine, puis mesure le coût d'un tick.
+ *
+ * La compensation reste sous le plafond électrique du mode: gain en
+ * DÉCOLLAGE / URGENCE seulement quand l'électrique a de la marge (descente,
+ * part électrique imposée par le programme de vol) ; en NORMAL (thermique
+ * seul) la commande électrique doit rester nulle.
+ *
+ * Compilation (depuis embedded/tools):
+ *   g++ -O2 -std=c++11 -I../PowerManagement spool_step_check.cpp \
+ *       ../PowerManagement/PowerController.cpp ../PowerManagement/PowerDistribution.cpp \
+ *       ../PowerManagement/PowerAllocator.cpp ../PowerManagement/SetpointRamp.cpp \
+ *       ../PowerManagement/ModeBlend.cpp ../PowerManagement/TurbineSpool.cpp \
+ *       ../PowerManagement/ModeLimits.cpp ../PowerManagement/Crc.cpp \
+ *       -o spool_step_check
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+#include "config.h"
+#include "PowerController.h"
+
+namespace {
+
+    typedef PowerDistribution::FlightMode Mode;
+
+    /**
+     * @brief Échelon de test
+     */
+    struct Step {
+        const char* label;  ///< Nom affiché
+        Mode fromMode;      ///< Mode avant l'échelon
+        uint16_t from;      ///< Consigne avant l'échelon (Cv)
+        Mode toMode;        ///< Mode après l'échelon
+        uint16_t to;        ///< Consigne après l'échelon (Cv)
+        uint16_t electric;  ///< Part électrique imposée (ELECTRIC_AUTO: mode)
+    };
+
+    /** @brief Répartition du mode, sans part imposée */
+    constexpr uint16_t AUTO = PowerController::ELECTRIC_AUTO;
+
+    /** @brief Durée maximale simulée par échelon (ticks) */
+    constexpr uint32_t MAX_TICKS = 600U;
+
+    /**
+     * @brief Régime établi: MAX_TICKS ticks à consigne constante
+     */
+    void settle(PowerController& controller, Mode mode, uint16_t power) {
+        for (uint32_t tick = 0U; tick < MAX_TICKS; tick++) {
+            controller.tick(mode, power);
+        }
+    }
+
+    /**
+     * @brief Temps pour atteindre 90 % de l'échelon de puissance délivrée
+     *
+     * @param electricPeak Commande électrique maximale pendant l'échelon (Cv)
+     * @return Durée en ms (MAX_TICKS × tick si jamais atteint)
+     */
+    uint32_t riseTime(const PowerDistribution& distribution, const Step& step, bool compensation,
+                      uint16_t& electricPeak) {
+        // Puissance délivrée finale (part imposée comprise)
+        PowerController target(distribution);
+        target.setElectricOverride(step.electric);
+        target.reset(step.toMode, step.to);
+        settle(target, step.toMode, step.to);
+        const int32_t final = target.getDelivered().total;
+
+        PowerController controller(distribution);
+        controller.setCompensation(compensation);
+        controller.setElectricOverride(step.electric);
+        controller.reset(step.fromMode, step.from);
+        settle(controller, step.fromMode, step.from);
+
+        const int32_t start = controller.getDelivered().total;
+        const int32_t threshold = start + ((final - start) * 9) / 10;
+
+        electricPeak = 0U;
+        for (uint32_t tick = 1U; tick <= MAX_TICKS; tick++) {
+            controller.tick(step.toMode, step.to);
+            const PowerDistribution::PowerOutput delivered = controller.getDelivered();
+            electricPeak = (delivered.electric > electricPeak) ? delivered.electric : electricPeak;
+            if ((final >= start) ? (delivered.total >= threshold) : (delivered.total <= threshold)) {
+                return tick * CONTROL_TICK_INTERVAL;
+            }
+        }
+        return MAX_TICKS * CONTROL_TICK_INTERVAL;
+    }
+}
+
+int main() {
+    const PowerDistribution distribution;
+
+    const Step steps[] = {
+        // Électrique au plafond avant la montée thermique: pas de marge
+        { "DÉCOLLAGE 0 → 3000",            Mode::DECOLLAGE, 0U,    Mode::DECOLLAGE, 3000U, AUTO },
+        { "URGENCE 200 → 3000",            Mode::URGENCE,   200U,  Mode::URGENCE,   3000U, AUTO },
+        // Descente: l'excès thermique est retranché de l'électrique
+        { "DÉCOLLAGE 2500 → 800",          Mode::DECOLLAGE, 2500U, Mode::DECOLLAGE, 800U,  AUTO },
+        { "URGENCE 3500 → 1200",           Mode::URGENCE,   3500U, Mode::URGENCE,   1200U, AUTO },
+        // Part électrique imposée (programme de vol): marge jusqu'au plafond
+        { "DÉCOLLAGE 1000 → 2500 (é 300)", Mode::DECOLLAGE, 1000U, Mode::DECOLLAGE, 2500U, 300U },
+        { "URGENCE 1000 → 3000 (é 300)",   Mode::URGENCE,   1000U, Mode::URGENCE,   3000U, 300U },
+        // Thermique seul: compensation sans effet, électrique nul
+        { "NORMAL 0 → 1500",               Mode::NORMAL,    0U,    Mode::NORMAL,    1500U, AUTO },
+        { "NORMAL 500 → 2500 (é 300)",     Mode::NORMAL,    500U,  Mode::NORMAL,    2500U, 300U }
+    };
+
+    printf("Tau turbine %u ms, tick %u ms, temps de montée à 90 %% (puissance délivrée)\n\n",
+           TURBINE_SPOOL_TAU_MS, CONTROL_TICK_INTERVAL);
+    printf("  %-32s %10s %10s %7s %9s\n", "échelon", "sans (ms)", "avec (ms)", "gain", "élec max");
+
+    int failures = 0;
+    for (const Step& step : steps) {
+        uint16_t plainPeak = 0U;
+        uint16_t electricPeak = 0U;
+        const uint32_t plain = riseTime(distribution, step, false, plainPeak);
+        const uint32_t compensated = riseTime(distribution, step, true, electricPeak);
+        const uint16_t electricMax = distribution.getProfile(step.toMode).getMax(PowerAllocator::Source::ELECTRIC);
+        const int32_t gain = (plain == 0U) ? 0
+            : static_cast<int32_t>(((static_cast<int64_t>(plain) - compensated) * 100) / plain);
+
+        printf("  %-32s %10u %10u %6d%% %9u\n", step.label, plain, compensated, gain, electricPeak);
+        if (compensated > plain) {
+            printf("ECHEC %s: plus lent avec compensation\n", step.label);
+            failures++;
+        }
+        // Jamais au-delà du plafond électrique du mode (0 en NORMAL)
+        const uint16_t startElectric = distribution.getProfile(step.fromMode).getMax(PowerAllocator::Source::ELECTRIC);
+        const uint16_t ceiling = (electricMax > startElectric) ? electricMax : startElectric;
+        if (electricPeak > ceiling || (step.toMode == Mode::NORMAL && electricPeak != 0U)) {
+            printf("ECHEC %s: électrique %u Cv > plafond %u Cv\n", step.label, electricPeak, ceiling);
+            failures++;
+        }
+    }
+
+    // Coût d'un tick (hôte, indicatif)
+    PowerController controller(distribution);
+    controller.reset(Mode::NORMAL, 0U);
+    const uint32_t ticks = 10000000U;
+    volatile uint32_t sink = 0U;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < ticks; i++) {
+        controller.tick(Mode::NORMAL, static_cast<uint16_t>((i >> 7) & 0x7FFU));
+        sink = sink + controller.getCommand().electric;
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    printf("\nCoût tick(): %.1f ns (hôte)\n",
+           std::chrono::duration<double, std::nano>(t1 - t0).count() / ticks);
+
+    if (failures != 0) {
+        printf("\n%d ECHEC(S)\n", failures);
+        return 1;
+    }
+
+    printf("\nOK\n");
+    return 0;
+}